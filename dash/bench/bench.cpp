@@ -0,0 +1,327 @@
+/*
+ * bench.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+/*
+ * Parses MPDs through IDASHManager::Open() over and over and reports per document:
+ *
+ *  wall        the median wall time of Open()
+ *  read        libxml2 reading the document      \
+ *  build       building the node tree             > the medians of dash::metrics::IParseStatistics
+ *  conv        converting into the MPD model     /
+ *  allocs      the allocations of one Open(), operator new and libxml2 together
+ *  peak        the most heap one Open() held at once on top of what was live before
+ *
+ * and the peak resident set of the whole run at the end.
+ *
+ * usage: bench [-n iterations] [-t conversion threads] [-s] <mpd>...
+ * -s adds a row per document for reopening it from its snapshot with OpenSnapshot().
+ */
+
+#include "libdash.h"
+
+#include <libxml/xmlmemory.h>
+#include <malloc.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+using namespace dash;
+using namespace dash::mpd;
+using namespace dash::metrics;
+
+/* every allocation of the process passes here, the conversion threads included */
+static std::atomic<uint64_t>    allocations (0);
+static std::atomic<int64_t>     liveBytes   (0);
+static std::atomic<int64_t>     peakBytes   (0);
+
+static void     Allocated       (void *p)
+{
+    if (p == NULL)
+        return;
+
+    allocations++;
+
+    int64_t live = liveBytes += malloc_usable_size(p);
+    int64_t peak = peakBytes.load();
+
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live));
+}
+static void     Released        (void *p)
+{
+    if (p != NULL)
+        liveBytes -= malloc_usable_size(p);
+}
+static void*    CountedMalloc   (size_t size)
+{
+    void *p = malloc(size);
+
+    Allocated(p);
+    return p;
+}
+static void     CountedFree     (void *p)
+{
+    Released(p);
+    free(p);
+}
+static void*    CountedRealloc  (void *p, size_t size)
+{
+    size_t  before  = p != NULL ? malloc_usable_size(p) : 0;
+    void    *q      = realloc(p, size);
+
+    if (q == NULL)
+        return NULL;
+
+    /* a moved block is a new allocation, one grown in place only changes the live bytes */
+    if (p == NULL || q != p)
+    {
+        liveBytes -= before;
+        Allocated(q);
+    }
+    else
+    {
+        liveBytes += (int64_t) malloc_usable_size(q) - (int64_t) before;
+    }
+
+    return q;
+}
+static char*    CountedStrdup   (const char *s)
+{
+    size_t  length  = strlen(s) + 1;
+    char    *p      = (char *) CountedMalloc(length);
+
+    if (p != NULL)
+        memcpy(p, s, length);
+
+    return p;
+}
+
+void*   operator new        (size_t size)
+{
+    void *p = CountedMalloc(size ? size : 1);
+
+    if (p == NULL)
+        throw std::bad_alloc();
+
+    return p;
+}
+void*   operator new[]      (size_t size)
+{
+    return operator new(size);
+}
+void*   operator new        (size_t size, const std::nothrow_t&) throw()
+{
+    return CountedMalloc(size ? size : 1);
+}
+void*   operator new[]      (size_t size, const std::nothrow_t&) throw()
+{
+    return CountedMalloc(size ? size : 1);
+}
+void    operator delete     (void *p) throw()
+{
+    CountedFree(p);
+}
+void    operator delete[]   (void *p) throw()
+{
+    CountedFree(p);
+}
+void    operator delete     (void *p, size_t) throw()
+{
+    CountedFree(p);
+}
+void    operator delete[]   (void *p, size_t) throw()
+{
+    CountedFree(p);
+}
+
+struct Sample
+{
+    uint64_t    wall;
+    uint64_t    read;
+    uint64_t    build;
+    uint64_t    conversion;
+    uint64_t    allocations;
+    int64_t     peak;
+};
+
+static uint64_t     Now             ()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+static uint64_t     Median          (std::vector<Sample> &samples, uint64_t Sample::*field)
+{
+    std::vector<uint64_t> values;
+
+    for (size_t i = 0; i < samples.size(); i++)
+        values.push_back(samples[i].*field);
+
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+static void         Report          (const std::string &name, const IParseStatistics *statistics, std::vector<Sample> &samples)
+{
+    int64_t peak = 0;
+
+    for (size_t i = 0; i < samples.size(); i++)
+        peak = std::max(peak, samples[i].peak);
+
+    printf("%-32s %10llu %8llu %8llu %9llu %9llu %9llu %9llu %9llu %9lld\n", name.c_str(),
+           (unsigned long long) statistics->GetDocumentSize(),
+           (unsigned long long) statistics->GetNodeCount(),
+           (unsigned long long) statistics->GetAttributeCount(),
+           (unsigned long long) Median(samples, &Sample::wall),
+           (unsigned long long) Median(samples, &Sample::read),
+           (unsigned long long) Median(samples, &Sample::build),
+           (unsigned long long) Median(samples, &Sample::conversion),
+           (unsigned long long) Median(samples, &Sample::allocations),
+           (long long) (peak / 1024));
+}
+static IMPD*        Measure         (IDASHManager *manager, const std::string &document, const std::string &url, const std::vector<char> *snapshot, Sample &sample)
+{
+    uint64_t allocationsBefore = allocations.load();
+    int64_t  liveBefore        = liveBytes.load();
+
+    peakBytes = liveBefore;
+
+    uint64_t    start   = Now();
+    IMPD        *mpd    = snapshot ? manager->OpenSnapshot(&(*snapshot)[0], snapshot->size(), url.c_str(), "bench")
+                                   : manager->Open(document.data(), document.size(), url.c_str());
+
+    sample.wall         = Now() - start;
+    sample.allocations  = allocations.load() - allocationsBefore;
+    sample.peak         = peakBytes.load() - liveBefore;
+
+    if (mpd == NULL)
+        return NULL;
+
+    const IParseStatistics *statistics = mpd->GetParseStatistics();
+
+    sample.read         = statistics->GetReadTime();
+    sample.build        = statistics->GetBuildTime();
+    sample.conversion   = statistics->GetConversionTime();
+    return mpd;
+}
+static bool         Run             (IDASHManager *manager, const char *path, int iterations, bool isSnapshotRun)
+{
+    std::ifstream       file(path, std::ios::binary);
+    std::stringstream   content;
+
+    if (!file)
+    {
+        fprintf(stderr, "%s: cannot read\n", path);
+        return false;
+    }
+
+    content << file.rdbuf();
+
+    std::string         document    = content.str();
+    std::string         url         = std::string("http://bench.example.com/") + path;
+    std::string         name        = path;
+    std::vector<char>   snapshot;
+
+    name = name.substr(name.find_last_of('/') + 1);
+
+    /* the first open warms up libxml2 and the allocator and takes the snapshot */
+    IMPD *mpd = manager->Open(document.data(), document.size(), url.c_str(), "bench", snapshot);
+
+    if (mpd == NULL)
+    {
+        fprintf(stderr, "%s: not an MPD\n", path);
+        return false;
+    }
+
+    delete(mpd);
+
+    for (int run = 0; run < (isSnapshotRun ? 2 : 1); run++)
+    {
+        std::vector<Sample> samples(iterations);
+        IMPD                *last = NULL;
+
+        for (int i = 0; i < iterations; i++)
+        {
+            delete(last);
+            last = Measure(manager, document, url, run ? &snapshot : NULL, samples[i]);
+
+            if (last == NULL)
+            {
+                fprintf(stderr, "%s: failed to open\n", path);
+                return false;
+            }
+        }
+
+        Report(run ? name + " (snapshot)" : name, last->GetParseStatistics(), samples);
+        delete(last);
+    }
+
+    return true;
+}
+
+int main (int argc, char **argv)
+{
+    xmlMemSetup(CountedFree, CountedMalloc, CountedRealloc, CountedStrdup);
+
+    int     iterations      = 20;
+    int     threads         = 0;
+    bool    isSnapshotRun   = false;
+    int     option;
+
+    while ((option = getopt(argc, argv, "n:t:s")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':   iterations      = std::max(1, atoi(optarg));    break;
+            case 't':   threads         = std::max(0, atoi(optarg));    break;
+            case 's':   isSnapshotRun   = true;                         break;
+            default:
+                fprintf(stderr, "usage: %s [-n iterations] [-t conversion threads] [-s] <mpd>...\n", argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind >= argc)
+    {
+        fprintf(stderr, "usage: %s [-n iterations] [-t conversion threads] [-s] <mpd>...\n", argv[0]);
+        return 1;
+    }
+
+    IDASHManager *manager = CreateDashManager();
+
+    manager->SetConversionThreads(threads);
+    manager->SetParseStatistics(true);
+
+    printf("%d iterations, %d conversion threads, times in us, peak heap in KiB\n", iterations, threads);
+    printf("%-32s %10s %8s %8s %9s %9s %9s %9s %9s %9s\n", "document", "bytes", "nodes", "attrs", "wall", "read", "build", "conv", "allocs", "peak");
+
+    bool ok = true;
+
+    for (int i = optind; i < argc; i++)
+        ok = Run(manager, argv[i], iterations, isSnapshotRun) && ok;
+
+    manager->Delete();
+
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+    printf("peak resident set %ld KiB\n", usage.ru_maxrss);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+/*
+ * corpus.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+/*
+ * Writes the synthetic MPDs the benchmark parses, each stressing another part of the parser:
+ *
+ *  vod.mpd             static, several periods of long SegmentLists, many small elements
+ *  timeline.mpd        dynamic, one SegmentTimeline with thousands of S elements, the shape live manifests grow into
+ *  adaptationsets.mpd  static, hundreds of adaptation sets with roles and content protection, wide instead of deep
+ *
+ * usage: corpus <directory> [scale]
+ * scale multiplies the segment and adaptation set counts, 1 gives documents of about a megabyte.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static const char   *MPDNamespace   = "xmlns=\"urn:mpeg:dash:schema:mpd:2011\" xmlns:xlink=\"http://www.w3.org/1999/xlink\"";
+static const char   *Languages[]    = { "en", "de", "fr", "es", "it", "pt", "nl", "sv", "pl", "ja", "ko", "zh" };
+static const int    LanguageCount   = sizeof(Languages) / sizeof(Languages[0]);
+
+static FILE*    OpenOutput      (const std::string &directory, const char *name)
+{
+    std::string path = directory + "/" + name;
+    FILE        *file = fopen(path.c_str(), "w");
+
+    if (file == NULL)
+        perror(path.c_str());
+    else
+        printf("%s\n", path.c_str());
+
+    return file;
+}
+static void     WriteVideo      (FILE *file, int representations, int firstBandwidth)
+{
+    for (int i = 0; i < representations; i++)
+    {
+        int height = 180 * (i + 1);
+
+        fprintf(file, "      <Representation id=\"v%d\" bandwidth=\"%d\" width=\"%d\" height=\"%d\" codecs=\"avc1.4d401f\" frameRate=\"25\"/>\n",
+                i, firstBandwidth * (i + 1), height * 16 / 9, height);
+    }
+}
+static bool     WriteVOD        (const std::string &directory, int scale)
+{
+    FILE *file = OpenOutput(directory, "vod.mpd");
+
+    if (file == NULL)
+        return false;
+
+    const int periods           = 3;
+    const int segments          = 300 * scale;
+    const int representations   = 6;
+
+    fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(file, "<MPD %s type=\"static\" mediaPresentationDuration=\"PT%dS\" minBufferTime=\"PT2S\" profiles=\"urn:mpeg:dash:profile:full:2011\">\n",
+            MPDNamespace, periods * segments * 2);
+    fprintf(file, "  <ProgramInformation moreInformationURL=\"http://example.com/\"><Title>vod</Title></ProgramInformation>\n");
+    fprintf(file, "  <BaseURL>http://cdn.example.com/vod/</BaseURL>\n");
+
+    for (int p = 0; p < periods; p++)
+    {
+        fprintf(file, "  <Period id=\"p%d\" start=\"PT%dS\" duration=\"PT%dS\">\n", p, p * segments * 2, segments * 2);
+        fprintf(file, "    <AdaptationSet id=\"1\" contentType=\"video\" mimeType=\"video/mp4\" segmentAlignment=\"true\" startWithSAP=\"1\">\n");
+
+        for (int r = 0; r < representations; r++)
+        {
+            int height = 180 * (r + 1);
+
+            fprintf(file, "      <Representation id=\"v%d\" bandwidth=\"%d\" width=\"%d\" height=\"%d\" codecs=\"avc1.4d401f\">\n",
+                    r, 400000 * (r + 1), height * 16 / 9, height);
+            fprintf(file, "        <BaseURL>video/%d/</BaseURL>\n", r);
+            fprintf(file, "        <SegmentList timescale=\"1000\" duration=\"2000\">\n");
+            fprintf(file, "          <Initialization sourceURL=\"init.mp4\"/>\n");
+
+            for (int s = 0; s < segments; s++)
+                fprintf(file, "          <SegmentURL media=\"p%d/%d.m4s\" mediaRange=\"%d-%d\"/>\n", p, s, s * 100000, s * 100000 + 99999);
+
+            fprintf(file, "        </SegmentList>\n");
+            fprintf(file, "      </Representation>\n");
+        }
+
+        fprintf(file, "    </AdaptationSet>\n");
+
+        for (int a = 0; a < 3; a++)
+        {
+            fprintf(file, "    <AdaptationSet id=\"%d\" contentType=\"audio\" mimeType=\"audio/mp4\" lang=\"%s\" codecs=\"mp4a.40.2\">\n", a + 2, Languages[a]);
+            fprintf(file, "      <AudioChannelConfiguration schemeIdUri=\"urn:mpeg:dash:23003:3:audio_channel_configuration:2011\" value=\"2\"/>\n");
+            fprintf(file, "      <SegmentTemplate timescale=\"48000\" duration=\"96000\" initialization=\"audio/%s/init.mp4\" media=\"audio/%s/p%d/$Number$.m4s\"/>\n",
+                    Languages[a], Languages[a], p);
+            fprintf(file, "      <Representation id=\"a%d\" bandwidth=\"128000\" audioSamplingRate=\"48000\"/>\n", a);
+            fprintf(file, "    </AdaptationSet>\n");
+        }
+
+        fprintf(file, "  </Period>\n");
+    }
+
+    fprintf(file, "</MPD>\n");
+    fclose(file);
+    return true;
+}
+static bool     WriteTimeline   (const std::string &directory, int scale)
+{
+    FILE *file = OpenOutput(directory, "timeline.mpd");
+
+    if (file == NULL)
+        return false;
+
+    const int   entries = 10000 * scale;
+    long long   t       = 0;
+
+    fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(file, "<MPD %s type=\"dynamic\" availabilityStartTime=\"2013-01-01T00:00:00Z\" publishTime=\"2013-01-02T00:00:00Z\" "
+                  "minimumUpdatePeriod=\"PT2S\" timeShiftBufferDepth=\"PT%dS\" minBufferTime=\"PT2S\" profiles=\"urn:mpeg:dash:profile:isoff-live:2011\">\n",
+            MPDNamespace, entries * 2);
+    fprintf(file, "  <UTCTiming schemeIdUri=\"urn:mpeg:dash:utc:http-iso:2014\" value=\"http://time.example.com/\"/>\n");
+    fprintf(file, "  <Period id=\"live\" start=\"PT0S\">\n");
+    fprintf(file, "    <AdaptationSet id=\"1\" contentType=\"video\" mimeType=\"video/mp4\" segmentAlignment=\"true\">\n");
+    fprintf(file, "      <SegmentTemplate timescale=\"90000\" initialization=\"$RepresentationID$/init.mp4\" media=\"$RepresentationID$/$Time$.m4s\">\n");
+    fprintf(file, "        <SegmentTimeline>\n");
+
+    /* encoders drift, so most entries stand alone and only some runs are folded into @r */
+    for (int i = 0; i < entries; i++)
+    {
+        int duration = 180000 + ((i * 7919) % 5) * 90 - 180;
+
+        if (i % 10 == 0)
+        {
+            fprintf(file, "          <S t=\"%lld\" d=\"%d\" r=\"2\"/>\n", t, duration);
+            t += 3LL * duration;
+        }
+        else
+        {
+            fprintf(file, "          <S t=\"%lld\" d=\"%d\"/>\n", t, duration);
+            t += duration;
+        }
+    }
+
+    fprintf(file, "        </SegmentTimeline>\n");
+    fprintf(file, "      </SegmentTemplate>\n");
+    WriteVideo(file, 5, 600000);
+    fprintf(file, "    </AdaptationSet>\n");
+    fprintf(file, "    <AdaptationSet id=\"2\" contentType=\"audio\" mimeType=\"audio/mp4\" lang=\"en\" codecs=\"mp4a.40.2\">\n");
+    fprintf(file, "      <SegmentTemplate timescale=\"48000\" duration=\"96000\" startNumber=\"0\" media=\"audio/$Number$.m4s\"/>\n");
+    fprintf(file, "      <Representation id=\"a\" bandwidth=\"128000\"/>\n");
+    fprintf(file, "    </AdaptationSet>\n");
+    fprintf(file, "  </Period>\n");
+    fprintf(file, "</MPD>\n");
+    fclose(file);
+    return true;
+}
+static bool     WriteAdaptationSets (const std::string &directory, int scale)
+{
+    FILE *file = OpenOutput(directory, "adaptationsets.mpd");
+
+    if (file == NULL)
+        return false;
+
+    const int adaptationSets = 400 * scale;
+
+    fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    fprintf(file, "<MPD %s type=\"static\" mediaPresentationDuration=\"PT1H\" minBufferTime=\"PT2S\" profiles=\"urn:mpeg:dash:profile:isoff-on-demand:2011\">\n",
+            MPDNamespace);
+    fprintf(file, "  <Period id=\"1\" duration=\"PT1H\">\n");
+
+    for (int i = 0; i < adaptationSets; i++)
+    {
+        const char *lang = Languages[i % LanguageCount];
+
+        fprintf(file, "    <AdaptationSet id=\"%d\" contentType=\"video\" mimeType=\"video/mp4\" lang=\"%s\" group=\"%d\" par=\"16:9\" maxWidth=\"1920\" maxHeight=\"1080\">\n",
+                i + 1, lang, i % 16);
+        fprintf(file, "      <ContentProtection schemeIdUri=\"urn:mpeg:dash:mp4protection:2011\" value=\"cenc\"/>\n");
+        fprintf(file, "      <ContentProtection schemeIdUri=\"urn:uuid:edef8ba9-79d6-4ace-a3c8-27dcd51d21ed\"/>\n");
+        fprintf(file, "      <Role schemeIdUri=\"urn:mpeg:dash:role:2011\" value=\"%s\"/>\n", i % 8 == 0 ? "main" : "alternate");
+        fprintf(file, "      <Accessibility schemeIdUri=\"urn:tva:metadata:cs:AudioPurposeCS:2007\" value=\"%d\"/>\n", i % 3);
+        fprintf(file, "      <SegmentTemplate timescale=\"25\" duration=\"50\" initialization=\"as%d/$RepresentationID$/init.mp4\" media=\"as%d/$RepresentationID$/$Number$.m4s\"/>\n",
+                i, i);
+        WriteVideo(file, 4, 500000);
+        fprintf(file, "    </AdaptationSet>\n");
+    }
+
+    fprintf(file, "  </Period>\n");
+    fprintf(file, "</MPD>\n");
+    fclose(file);
+    return true;
+}
+
+int main (int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <directory> [scale]\n", argv[0]);
+        return 1;
+    }
+
+    std::string directory   = argv[1];
+    int         scale       = argc > 2 ? atoi(argv[2]) : 1;
+
+    if (scale < 1)
+        scale = 1;
+
+    bool ok = WriteVOD(directory, scale);
+    ok = WriteTimeline(directory, scale) && ok;
+    ok = WriteAdaptationSets(directory, scale) && ok;
+
+    return ok ? 0 : 1;
+}
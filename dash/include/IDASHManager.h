@@ -2,6 +2,10 @@
  *  @class      dash::IDASHManager
  *  @brief      This interface is needed for generating an IMPD object from the information found in a MPD file
  *  @details    By invoking the method Open(char *path) all the information found in the MPD file specified by \em path is mapped to corresponding IMPD objects.
+ *              Open(const char *buffer, size_t length, const char *url) does the same for an MPD that was already fetched into memory.
+ *              Update() merges a refreshed revision of a dynamic MPD into one opened before.
+ *              OpenSnapshot() reopens an MPD from a binary snapshot taken while it was opened before, without parsing any XML.
+ *              ResolveXLink() replaces an element by the remote elements it refers to on request.
  *  @see        dash::mpd::IMPD
  *
  *  @author     bitmovin Softwareentwicklung OG \n
@@ -19,6 +23,7 @@
 #include "config.h"
 
 #include "IMPD.h"
+#include "IMPDUpdate.h"
 #include "IConnection.h"
 
 namespace dash
@@ -35,6 +40,88 @@ namespace dash
              */
             virtual mpd::IMPD* Open (char *path) = 0;
 
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the the information found in the MPD document held in memory.\n
+             *  This lets the caller fetch the MPD with its own network stack, libxml2 doesn't touch the network then.
+             *  @param      buffer  the MPD document
+             *  @param      length  the length of the document in bytes
+             *  @param      url     the URI the document was fetched from, after redirects, relative URIs in the MPD are resolved against it
+             *  @return     a pointer to an dash::mpd::IMPD object
+             */
+            virtual mpd::IMPD* Open (const char *buffer, size_t length, const char *url) = 0;
+
+            /**
+             *  Does the same as Open(const char *buffer, size_t length, const char *url) and also takes a snapshot of the document.\n
+             *  The snapshot is a compact, versioned binary image of the parsed document that contains no pointers, so it can be stored,
+             *  e.g. in a file named after \em url and \em etag, and mapped back in later. OpenSnapshot() turns it into an MPD again without parsing any XML.
+             *  @param      buffer      the MPD document
+             *  @param      length      the length of the document in bytes
+             *  @param      url         the URI the document was fetched from, after redirects, relative URIs in the MPD are resolved against it
+             *  @param      etag        the entity tag the server sent along with the document, or any other string identifying its revision
+             *  @param      snapshot    receives the snapshot, it is left empty if the document could not be parsed
+             *  @return     a pointer to an dash::mpd::IMPD object
+             */
+            virtual mpd::IMPD* Open (const char *buffer, size_t length, const char *url, const char *etag, std::vector<char> &snapshot) = 0;
+
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the MPD a snapshot was taken of, see Open(const char *buffer, size_t length, const char *url, const char *etag, std::vector<char> &snapshot).\n
+             *  The snapshot is only read during the call, it may be unmapped or freed afterwards.
+             *  @param      snapshot    the snapshot, e.g. a file mapped into memory
+             *  @param      length      the length of the snapshot in bytes
+             *  @param      url         the URI the snapshot was taken with
+             *  @param      etag        the entity tag the snapshot was taken with
+             *  @return     a pointer to an dash::mpd::IMPD object, or \c NULL if the snapshot was taken with another \em url or \em etag,
+             *              by another version of libdash or on a machine of another byte order, or is damaged
+             */
+            virtual mpd::IMPD* OpenSnapshot (const char *snapshot, size_t length, const char *url, const char *etag) = 0;
+
+            /**
+             *  Merges a refreshed revision of a dynamic MPD into \em mpd instead of building a new dash::mpd::IMPD object.\n
+             *  Periods, adaptation sets and representations are matched by their \c \@id, or by their position if they have none.
+             *  Matching elements and the <tt><b>S</b></tt> elements of their segment timelines keep their address, so a refresh costs little more than parsing the document.
+             *  @param      mpd     an MPD returned by Open()
+             *  @param      buffer  the refreshed MPD document
+             *  @param      length  the length of the document in bytes
+             *  @param      url     the URI the document was fetched from, after redirects
+             *  @return     a pointer to a dash::mpd::IMPDUpdate object describing the changes, which has to be deleted by the caller,
+             *              or \c NULL if the document could not be parsed, \em mpd is left untouched then
+             */
+            virtual mpd::IMPDUpdate*    Update  (mpd::IMPD *mpd, const char *buffer, size_t length, const char *url) = 0;
+
+            /**
+             *  Replaces an element that refers to a remote element with <tt>xlink:actuate="onRequest"</tt> by the elements it refers to, see ISO/IEC 23009-1, section 5.5.\n
+             *  References with <tt>xlink:actuate="onLoad"</tt> are already resolved by Open(), Update() and OpenSnapshot(), the remote documents of one pass are fetched concurrently.
+             *  Documents are kept by their URI, so a reference that reappears in a refreshed MPD is not fetched again.
+             *  @param      mpd     an MPD returned by Open()
+             *  @param      element the dash::mpd::IPeriod, dash::mpd::IAdaptationSet or dash::mpd::ISegmentList holding the reference
+             *  @return     a pointer to a dash::mpd::IMPDUpdate object listing a removed period or adaptation set and the ones added in its place, which has to be deleted by the caller.
+             *              \em element stays valid until then. \c NULL if \em element holds no reference or it could not be resolved, \em mpd is left untouched then
+             */
+            virtual mpd::IMPDUpdate*    ResolveXLink    (mpd::IMPD *mpd, mpd::IMPDElement *element) = 0;
+
+            /**
+             *  Sets how many worker threads convert the <tt><b>Period</b></tt> and <tt><b>AdaptationSet</b></tt> elements of MPDs opened afterwards.\n
+             *  These are independent of each other, so on manifests with many of them the conversion scales with the cores while the document is still being read.
+             *  @param      threads     the number of worker threads per Open() call, \c 0 converts everything on the calling thread, which is the default
+             */
+            virtual void        SetConversionThreads    (uint32_t threads) = 0;
+
+            /**
+             *  Sets whether MPDs opened afterwards record what building them cost, see dash::mpd::IMPD::GetParseStatistics().\n
+             *  This is meant for measuring the parser on a corpus of manifests, every read of the XML reader is timed then, which costs a few percent.
+             *  @param      enable      \c true to record the statistics, \c false by default
+             */
+            virtual void        SetParseStatistics      (bool enable) = 0;
+
+            /**
+             *  Sets the connection the remote elements referred to by <tt>xlink:href</tt> are downloaded through, see ResolveXLink().\n
+             *  This lets the application fetch them with its own network stack, e.g. the one it fetches the MPD with.
+             *  Each remote element is a dash::network::IChunk read on a thread of its own, so \em connection has to cope with concurrent calls.
+             *  Without a connection they are downloaded by libcurl on the calling thread, giving up on a server after a few seconds.
+             *  @param      connection  the connection, which has to outlive this object, or \c NULL for the built-in download
+             */
+            virtual void        SetXLinkConnection      (network::IConnection *connection) = 0;
+
             /**
              *  Frees allocated memory and deletes the DashManager
              */
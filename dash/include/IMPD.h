@@ -40,6 +40,7 @@
 #include "IPeriod.h"
 #include "IMetrics.h"
 #include "IDASHMetrics.h"
+#include "IParseStatistics.h"
 
 namespace dash
 {
@@ -200,6 +201,67 @@ namespace dash
                  *  @return     an unsigned integer
                  */
                 virtual uint32_t                                    GetFetchTime                    ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@availabilityStartTime</tt> in milliseconds since 1970-01-01T00:00:00Z, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetAvailabilityStarttimeInMs    ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@availabilityEndTime</tt> in milliseconds since 1970-01-01T00:00:00Z, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetAvailabilityEndtimeInMs      ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@mediaPresentationDuration</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetMediaPresentationDurationInMs()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@minimumUpdatePeriod</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetMinimumUpdatePeriodInMs      ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@minBufferTime</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetMinBufferTimeInMs            ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@timeShiftBufferDepth</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetTimeShiftBufferDepthInMs     ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@suggestedPresentationDelay</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetSuggestedPresentationDelayInMs()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@maxSegmentDuration</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetMaxSegmentDurationInMs       ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>MPD</b>\@maxSubsegmentDuration</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                     GetMaxSubsegmentDurationInMs    ()  const = 0;
+
+                /**
+                 *  Returns what building this MPD from its document cost, see dash::IDASHManager::SetParseStatistics().
+                 *  After dash::IDASHManager::Update() it describes the revision merged last.
+                 *  @return     a pointer to a dash::metrics::IParseStatistics object, or \c NULL if the statistics were not enabled when the MPD was opened
+                 */
+                virtual const dash::metrics::IParseStatistics*      GetParseStatistics              ()  const = 0;
         };
     }
 }
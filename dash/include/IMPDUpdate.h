@@ -0,0 +1,84 @@
+/**
+ *  @class      dash::mpd::IMPDUpdate
+ *  @brief      This interface is needed for accessing the changes a refreshed revision of a dynamic MPD made to an already opened dash::mpd::IMPD
+ *  @details    It is returned by dash::IDASHManager::Update(). Everything the revision describes in the same way as before keeps its address,
+ *              so pointers the client holds to periods, adaptation sets, representations and segment timelines stay valid across refreshes.\n
+ *              Only the topmost element that was added or removed is reported, e.g. the representations of an added adaptation set are not listed separately.\n
+ *              Removed elements are no longer part of the MPD, but stay valid until the dash::mpd::IMPDUpdate object is deleted by the caller.
+ *  @see        dash::IDASHManager dash::mpd::IMPD
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IMPDUPDATE_H_
+#define IMPDUPDATE_H_
+
+#include "config.h"
+
+#include "IPeriod.h"
+#include "IAdaptationSet.h"
+#include "IRepresentation.h"
+#include "ISegmentTimeline.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class IMPDUpdate
+        {
+            public:
+                virtual ~IMPDUpdate(){}
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IPeriod objects the revision added to the MPD
+                 *  @return     a reference to a vector of pointers to dash::mpd::IPeriod objects
+                 */
+                virtual const std::vector<IPeriod *>&           GetAddedPeriods                 ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IPeriod objects the revision no longer contains
+                 *  @return     a reference to a vector of pointers to dash::mpd::IPeriod objects
+                 */
+                virtual const std::vector<IPeriod *>&           GetRemovedPeriods               ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IAdaptationSet objects the revision added to periods that were already known
+                 *  @return     a reference to a vector of pointers to dash::mpd::IAdaptationSet objects
+                 */
+                virtual const std::vector<IAdaptationSet *>&    GetAddedAdaptationSets          ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IAdaptationSet objects the revision removed from periods it still contains
+                 *  @return     a reference to a vector of pointers to dash::mpd::IAdaptationSet objects
+                 */
+                virtual const std::vector<IAdaptationSet *>&    GetRemovedAdaptationSets        ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IRepresentation objects the revision added to adaptation sets that were already known
+                 *  @return     a reference to a vector of pointers to dash::mpd::IRepresentation objects
+                 */
+                virtual const std::vector<IRepresentation *>&   GetAddedRepresentations         ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::IRepresentation objects the revision removed from adaptation sets it still contains
+                 *  @return     a reference to a vector of pointers to dash::mpd::IRepresentation objects
+                 */
+                virtual const std::vector<IRepresentation *>&   GetRemovedRepresentations       ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the dash::mpd::ISegmentTimeline objects whose segments changed,
+                 *  typically because new <tt><b>S</b></tt> elements were appended and old ones slid out of the time shift buffer.
+                 *  @return     a reference to a vector of pointers to dash::mpd::ISegmentTimeline objects
+                 */
+                virtual const std::vector<ISegmentTimeline *>&  GetChangedSegmentTimelines      ()  const = 0;
+        };
+    }
+}
+
+#endif /* IMPDUPDATE_H_ */
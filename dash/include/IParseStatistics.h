@@ -0,0 +1,81 @@
+/**
+ *  @class      dash::metrics::IParseStatistics
+ *  @brief      This interface is needed for accessing what building a single dash::mpd::IMPD object from its document cost
+ *  @details    The time is split into the stages of Open(): libxml2 reading the document, building the node tree from it and converting the tree into the MPD model.
+ *              Reading and building interleave, each read of the libxml2 reader is timed on its own, so the split stays exact.
+ *              Subtrees converted while the document is still read count as conversion. With conversion threads, conversion is the time the calling thread
+ *              spent on or waited for it, not the sum over the threads.\n
+ *              The heap belongs to the application, so allocations are given as the elements and attributes the document held, each of which costs
+ *              about one allocation in the node tree. Allocation counts and peak memory in bytes are left to the application's allocator.
+ *  @see        dash::mpd::IMPD dash::IDASHManager
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IPARSESTATISTICS_H_
+#define IPARSESTATISTICS_H_
+
+#include "config.h"
+
+namespace dash
+{
+    namespace metrics
+    {
+        class IParseStatistics
+        {
+            public:
+                virtual ~IParseStatistics(){}
+
+                /**
+                 *  Returns the size of the document, or of the snapshot it was opened from, in bytes
+                 *  @return     an unsigned integer, \c 0 if the document was read from a file by libxml2
+                 */
+                virtual uint64_t    GetDocumentSize     () const = 0;
+
+                /**
+                 *  Returns the number of elements and texts the document held
+                 *  @return     an unsigned integer, \c 0 for a snapshot
+                 */
+                virtual uint64_t    GetNodeCount        () const = 0;
+
+                /**
+                 *  Returns the number of attributes the document held
+                 *  @return     an unsigned integer, \c 0 for a snapshot
+                 */
+                virtual uint64_t    GetAttributeCount   () const = 0;
+
+                /**
+                 *  Returns the time libxml2 spent reading the document, \c 0 for a snapshot
+                 *  @return     the time in microseconds
+                 */
+                virtual uint64_t    GetReadTime         () const = 0;
+
+                /**
+                 *  Returns the time spent building the node tree, for a snapshot the time spent reading the image
+                 *  @return     the time in microseconds
+                 */
+                virtual uint64_t    GetBuildTime        () const = 0;
+
+                /**
+                 *  Returns the time spent converting the node tree into the MPD model
+                 *  @return     the time in microseconds
+                 */
+                virtual uint64_t    GetConversionTime   () const = 0;
+
+                /**
+                 *  Returns the wall time the MPD took to open, from handing over the document to the returned dash::mpd::IMPD object,
+                 *  including resolving the <tt>xlink:actuate="onLoad"</tt> references
+                 *  @return     the time in microseconds
+                 */
+                virtual uint64_t    GetTotalTime        () const = 0;
+        };
+    }
+}
+
+#endif /* IPARSESTATISTICS_H_ */
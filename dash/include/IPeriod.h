@@ -28,7 +28,7 @@
  *              representing an Early Available Period in later updates of the MPD as long as no \em PeriodStart time is associated with the Period. \n\n
  *              To avoid dereferencing of a remote element containing a <tt><b>Period</b></tt> element solely to determine the Period timeline, e.g. in case of seeking, 
  *              <tt><b>Period</b>\@start</tt> or previous Period's <tt><b>Period</b>\@duration</tt> should be present in the MPD.
- *  @see        dash::mpd::IMPDElement dash::mpd::BaseUrl dash::mpd::IAdaptationSet dash::mpd::ISegmentBase dash::mpd::ISegmentList dash::mpd::ISegmentTemplate dash::mpd::ISubset
+ *  @see        dash::mpd::IMPDElement dash::mpd::BaseUrl dash::mpd::IAdaptationSet dash::mpd::ISegmentBase dash::mpd::ISegmentList dash::mpd::ISegmentTemplate dash::mpd::ISubset dash::mpd::IPeriodIndex
  *
  *  @author     bitmovin Softwareentwicklung OG \n
  *              Email: libdash-dev@vicky.bitmovin.net
@@ -51,6 +51,7 @@
 #include "ISegmentTemplate.h"
 #include "IAdaptationSet.h"
 #include "ISubset.h"
+#include "IPeriodIndex.h"
 
 namespace dash
 {
@@ -142,6 +143,18 @@ namespace dash
                  */
                 virtual const std::string&                      GetDuration             ()  const = 0;
 
+                /**
+                 *  Returns the value of <tt><b>Period</b>\@start</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                 GetStartInMs            ()  const = 0;
+
+                /**
+                 *  Returns the value of <tt><b>Period</b>\@duration</tt> in milliseconds, parsed once when the MPD is loaded.
+                 *  @return     a signed integer, -1 if the attribute is not present or can't be parsed
+                 */
+                virtual int64_t                                 GetDurationInMs         ()  const = 0;
+
                 /**
                  *  When set to \c 'true', this is equivalent as if the <tt><b>AdaptationSet</b>\@bitstreamSwitching</tt> for each Adaptation Set contained in this Period is set to \c 'true'.
                  *  In this case, the <tt><b>AdaptationSet</b>\@bitstreamSwitching</tt> attribute shall not be set to \c 'false' for any Adaptation Set in this Period.
@@ -149,6 +162,14 @@ namespace dash
                  */
                 virtual bool                                    GetBitstreamSwitching   ()  const = 0;
 
+                /**
+                 *  Returns an index of the adaptation sets and representations of this Period, so clients select them by bandwidth, resolution, codec,
+                 *  language or role in logarithmic time instead of scanning the Period on every decision.\n
+                 *  It is built on the first call and stays valid until the adaptation sets of the Period change, see dash::mpd::IPeriodIndex.
+                 *  @return     a pointer to a dash::mpd::IPeriodIndex object
+                 */
+                virtual const IPeriodIndex*                     GetIndex                ()  const = 0;
+
         };
     }
 }
@@ -0,0 +1,102 @@
+/**
+ *  @class      dash::mpd::IPeriodIndex
+ *  @brief      This interface is needed for looking up the adaptation sets and representations of a single <tt><b>Period</b></tt> element
+ *              by the properties clients select them by, without scanning the period
+ *  @details    It is built on the first call of dash::mpd::IPeriod::GetIndex() and kept by the period, each lookup takes logarithmic time.
+ *              When dash::IDASHManager::Update() or dash::IDASHManager::ResolveXLink() change the adaptation sets of the period,
+ *              the index is dropped and dash::mpd::IPeriod::GetIndex() has to be called again.\n
+ *              All the vectors returned are ordered the same way, ascending in bandwidth for representations and in document order for adaptation sets.
+ *              Lookups that don't match anything return an empty vector or \c NULL.
+ *  @see        dash::mpd::IPeriod dash::mpd::IAdaptationSet dash::mpd::IRepresentation
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IPERIODINDEX_H_
+#define IPERIODINDEX_H_
+
+#include "config.h"
+
+#include "IAdaptationSet.h"
+#include "IRepresentation.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class IPeriodIndex
+        {
+            public:
+                virtual ~IPeriodIndex(){}
+
+                /**
+                 *  Returns the representations of an adaptation set sorted by their <tt>\@bandwidth</tt> attribute, the ladder adaptation switches along.
+                 *  @param      adaptationSet   an adaptation set of the period
+                 *  @return     a reference to a vector of pointers to dash::mpd::IRepresentation objects, lowest bandwidth first
+                 */
+                virtual const std::vector<IRepresentation *>&   GetBandwidthLadder              (const IAdaptationSet *adaptationSet) const = 0;
+
+                /**
+                 *  Returns the representation of an adaptation set with the highest <tt>\@bandwidth</tt> that does not exceed \em bandwidth.
+                 *  @param      adaptationSet   an adaptation set of the period
+                 *  @param      bandwidth       the available bandwidth in bits per second
+                 *  @return     a pointer to a dash::mpd::IRepresentation object, the one with the lowest bandwidth if all exceed \em bandwidth
+                 */
+                virtual IRepresentation*                        GetRepresentationForBandwidth   (const IAdaptationSet *adaptationSet, uint32_t bandwidth) const = 0;
+
+                /**
+                 *  Returns the representation of an adaptation set with the largest picture that fits into \em width by \em height,
+                 *  judged by <tt>\@height</tt> first and <tt>\@width</tt> second, the highest bandwidth wins among equal ones.
+                 *  @param      adaptationSet   an adaptation set of the period
+                 *  @param      width           the width of the display in pixels
+                 *  @param      height          the height of the display in pixels
+                 *  @return     a pointer to a dash::mpd::IRepresentation object, \c NULL if none fits
+                 */
+                virtual IRepresentation*                        GetRepresentationForResolution  (const IAdaptationSet *adaptationSet, uint32_t width, uint32_t height) const = 0;
+
+                /**
+                 *  Returns the representation with the given <tt>\@id</tt>, which is unique within a period.
+                 *  @param      id      the id of the representation
+                 *  @return     a pointer to a dash::mpd::IRepresentation object
+                 */
+                virtual IRepresentation*                        GetRepresentation               (const std::string &id) const = 0;
+
+                /**
+                 *  Returns the adaptation set a representation belongs to.
+                 *  @param      representation  a representation of the period
+                 *  @return     a pointer to a dash::mpd::IAdaptationSet object
+                 */
+                virtual IAdaptationSet*                         GetAdaptationSet                (const IRepresentation *representation) const = 0;
+
+                /**
+                 *  Returns the adaptation sets whose <tt>\@lang</tt> attribute equals \em lang, compared as given in the MPD.
+                 *  @param      lang    a language code as defined in RFC 5646, e.g. \c en or \c de-AT
+                 *  @return     a reference to a vector of pointers to dash::mpd::IAdaptationSet objects
+                 */
+                virtual const std::vector<IAdaptationSet *>&    GetAdaptationSetsByLang         (const std::string &lang) const = 0;
+
+                /**
+                 *  Returns the adaptation sets with a <tt><b>Role</b></tt> element whose <tt>\@value</tt> equals \em role, e.g. \c main or \c commentary
+                 *  of the scheme <tt>urn:mpeg:dash:role:2011</tt>.
+                 *  @param      role    the value of the role
+                 *  @return     a reference to a vector of pointers to dash::mpd::IAdaptationSet objects
+                 */
+                virtual const std::vector<IAdaptationSet *>&    GetAdaptationSetsByRole         (const std::string &role) const = 0;
+
+                /**
+                 *  Returns the representations with a codec, taken from the adaptation set if the representation names none.
+                 *  @param      codec   either a complete entry of <tt>\@codecs</tt> like \c avc1.4d401f or only its four character code like \c avc1
+                 *  @return     a reference to a vector of pointers to dash::mpd::IRepresentation objects, lowest bandwidth first
+                 */
+                virtual const std::vector<IRepresentation *>&   GetRepresentationsByCodec       (const std::string &codec) const = 0;
+        };
+    }
+}
+
+#endif /* IPERIODINDEX_H_ */
@@ -43,6 +43,33 @@ namespace dash
                  *  @return     a reference to vector of pointers to dash::mpd::ITimeline objects
                  */
                 virtual std::vector<ITimeline *>&   GetTimelines ()  const = 0;
+
+                /**
+                 *  Returns the number of segments described by all <b><tt>S</tt></b> elements together, with their \c \@r repeats expanded.\n
+                 *  A negative \c \@r on the last <b><tt>S</tt></b> element leaves the timeline open ended, in which case \c UINT64_MAX is returned.
+                 *  @return     the number of segments in the timeline
+                 */
+                virtual uint64_t                    GetSegmentCount     ()  const = 0;
+
+                /**
+                 *  Looks up the first segment that ends after the given time, that is the segment containing it or, if the time falls into a gap, the segment following the gap.\n
+                 *  The lookup uses an index of the <b><tt>S</tt></b> elements built on first use, so its cost doesn't depend on where in the timeline the time lies.
+                 *  @param      time        the time in units of the \c \@timescale attribute, on the same scale as \c \@t of the <b><tt>S</tt></b> elements
+                 *  @param      index       receives the zero based position of the segment in the timeline, to be added to \c \@startNumber for its number
+                 *  @param      startTime   receives the start time of the segment
+                 *  @param      duration    receives the duration of the segment
+                 *  @return     \c false if no segment ends after the given time
+                 */
+                virtual bool                        FindSegmentByTime   (uint64_t time, uint64_t& index, uint64_t& startTime, uint64_t& duration) const = 0;
+
+                /**
+                 *  Looks up the segment at the given position in the timeline.
+                 *  @param      index       the zero based position of the segment in the timeline
+                 *  @param      startTime   receives the start time of the segment
+                 *  @param      duration    receives the duration of the segment
+                 *  @return     \c false if the timeline has no segment at the given position
+                 */
+                virtual bool                        FindSegmentByIndex  (uint64_t index, uint64_t& startTime, uint64_t& duration) const = 0;
         };
     }
 }
@@ -10,6 +10,13 @@
  *****************************************************************************/
 
 #include "Time.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined _WIN32 || defined _WIN64
+    #define _WINSOCKAPI_
+    #include <Windows.h>
+#endif
 
 using namespace dash::helpers;
 
@@ -24,6 +31,94 @@ std::string Time::GetCurrentUTCTimeStr   ()
 
     return std::string(timeString);
 }
+int64_t     Time::ParseDuration         (const std::string &duration)
+{
+    /* xs:duration like PT1H2M3.5S in milliseconds, -1 if missing or malformed */
+    const char *p = duration.c_str();
+    if (*p++ != 'P')
+        return -1;
+
+    double  seconds = 0;
+    bool    inTime  = false;
+
+    while (*p)
+    {
+        if (*p == 'T' && !inTime)
+        {
+            inTime = true;
+            p++;
+            continue;
+        }
+
+        char *end = NULL;
+        double value = strtod(p, &end);
+        if (end == p)
+            return -1;
+        p = end;
+
+        switch (*p++)
+        {
+            case 'Y':   seconds += value * 365 * 24 * 3600;                     break;
+            case 'M':   seconds += inTime ? value * 60 : value * 30 * 24 * 3600;  break;
+            case 'W':   seconds += value * 7 * 24 * 3600;                       break;
+            case 'D':   seconds += value * 24 * 3600;                           break;
+            case 'H':   seconds += value * 3600;                                break;
+            case 'S':   seconds += value;                                       break;
+            default:    return -1;
+        }
+    }
+
+    if (seconds < 0)
+        return -1;
+
+    return (int64_t) (seconds * 1000 + 0.5);
+}
+int64_t     Time::ParseDateTime         (const std::string &dateTime)
+{
+    /* xs:dateTime like 2013-08-10T22:03:16Z in milliseconds since 1970, -1 if missing or malformed, local times are taken as utc */
+    int     year = 0, month = 0, day = 0, hour = 0, minute = 0, consumed = 0;
+    double  second = 0;
+
+    if (sscanf(dateTime.c_str(), "%d-%d-%dT%d:%d:%lf%n", &year, &month, &day, &hour, &minute, &second, &consumed) != 6 ||
+        month < 1 || month > 12 || day < 1 || day > 31)
+        return -1;
+
+    /* days from the proleptic gregorian date */
+    int     y       = year - (month <= 2 ? 1 : 0);
+    int     era     = (y >= 0 ? y : y - 399) / 400;
+    int     yoe     = y - era * 400;
+    int     doy     = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int     doe     = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    int64_t days    = (int64_t) era * 146097 + doe - 719468;
+
+    int64_t result  = ((days * 24 + hour) * 60 + minute) * 60000 + (int64_t) (second * 1000 + 0.5);
+
+    const char  *zone       = dateTime.c_str() + consumed;
+    int         zoneHours   = 0, zoneMinutes = 0;
+
+    if ((*zone == '+' || *zone == '-') && sscanf(zone + 1, "%d:%d", &zoneHours, &zoneMinutes) >= 1)
+        result -= (*zone == '-' ? -1 : 1) * (int64_t) (zoneHours * 60 + zoneMinutes) * 60000;
+
+    return result;
+}
+uint64_t    Time::GetMonotonicTimeInUs  ()
+{
+    /* for measuring intervals only, the origin is arbitrary */
+#if defined _WIN32 || defined _WIN64
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t) (counter.QuadPart / frequency.QuadPart) * 1000000 + (uint64_t) (counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
 struct tm*  Time::GetCurrentUTCTime     ()
 {
     time_t      rawTime;
@@ -24,6 +24,9 @@ namespace dash
             public:
                 static uint32_t     GetCurrentUTCTimeInSec  ();
                 static std::string  GetCurrentUTCTimeStr    ();
+                static int64_t      ParseDuration           (const std::string &duration);
+                static int64_t      ParseDateTime           (const std::string &dateTime);
+                static uint64_t     GetMonotonicTimeInUs    ();
 
             private:
                 static struct tm*   GetCurrentUTCTime       ();
@@ -0,0 +1,297 @@
+/*
+ * Url.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Url.h"
+
+using namespace dash::helpers;
+
+Url::Url    ()  :
+        url(""),
+        scheme(""),
+        authority(""),
+        host(""),
+        port(0),
+        path(""),
+        query(""),
+        fragment(""),
+        hasAuthority(false),
+        hasQuery(false),
+        hasFragment(false)
+{
+}
+Url::Url    (const std::string &url)  :
+        port(0),
+        hasAuthority(false),
+        hasQuery(false),
+        hasFragment(false)
+{
+    this->Parse(url);
+    RemoveDotSegments(this->path);
+    this->Compose();
+}
+Url::~Url   ()
+{
+}
+
+Url                 Url::Resolve            (const std::string &reference) const
+{
+    return this->Resolve(Url::FromReference(reference));
+}
+Url                 Url::Resolve            (const Url &relative) const
+{
+    Url target;
+
+    if (!relative.scheme.empty())
+    {
+        target = relative;
+        RemoveDotSegments(target.path);
+        target.Compose();
+        return target;
+    }
+
+    target.scheme = this->scheme;
+
+    if (relative.hasAuthority)
+    {
+        target.authority    = relative.authority;
+        target.hasAuthority = true;
+        target.path         = relative.path;
+        target.query        = relative.query;
+        target.hasQuery     = relative.hasQuery;
+        target.SplitAuthority();
+        RemoveDotSegments(target.path);
+    }
+    else
+    {
+        target.authority    = this->authority;
+        target.hasAuthority = this->hasAuthority;
+        target.host         = this->host;
+        target.port         = this->port;
+
+        if (relative.path.empty())
+        {
+            target.path     = this->path;
+            target.query    = relative.hasQuery ? relative.query : this->query;
+            target.hasQuery = relative.hasQuery || this->hasQuery;
+        }
+        else
+        {
+            if (relative.path.at(0) == '/')
+            {
+                target.path = relative.path;
+            }
+            else if (this->hasAuthority && this->path.empty())
+            {
+                target.path = "/" + relative.path;
+            }
+            else
+            {
+                /* merge with everything up to the last segment of the base path, which was normalized already */
+                size_t slash = this->path.find_last_of('/');
+                target.path.reserve(slash + 1 + relative.path.size());
+                if (slash != std::string::npos)
+                    target.path.assign(this->path, 0, slash + 1);
+                target.path += relative.path;
+            }
+
+            target.query    = relative.query;
+            target.hasQuery = relative.hasQuery;
+            RemoveDotSegments(target.path);
+        }
+    }
+
+    target.fragment     = relative.fragment;
+    target.hasFragment  = relative.hasFragment;
+    target.Compose();
+    return target;
+}
+Url                 Url::FromReference      (const std::string &reference)
+{
+    Url relative;
+    relative.Parse(reference);
+    relative.url = reference;
+    return relative;
+}
+bool                Url::IsHttp             ()  const
+{
+    return (this->scheme == "http" || this->scheme == "https") && !this->host.empty();
+}
+const std::string&  Url::ToString           ()  const
+{
+    return this->url;
+}
+const std::string&  Url::GetHost            ()  const
+{
+    return this->host;
+}
+size_t              Url::GetPort            ()  const
+{
+    return this->port;
+}
+std::string         Url::GetPathAndQuery    ()  const
+{
+    std::string pathAndQuery = this->path.empty() ? "/" : this->path;
+
+    if (this->hasQuery)
+    {
+        pathAndQuery += '?';
+        pathAndQuery += this->query;
+    }
+
+    return pathAndQuery;
+}
+void                Url::Parse              (const std::string &url)
+{
+    /* scheme ":" ["//" authority] path ["?" query] ["#" fragment], see RFC 3986, appendix B */
+    size_t pos = 0;
+    size_t end = url.find_first_of(":/?#");
+
+    if (end != std::string::npos && end > 0 && url.at(end) == ':' && isalpha((unsigned char) url.at(0)))
+    {
+        this->scheme = url.substr(0, end);
+        for (size_t i = 0; i < this->scheme.size(); i++)
+            this->scheme.at(i) = (char) tolower((unsigned char) this->scheme.at(i));
+        pos = end + 1;
+    }
+
+    if (url.compare(pos, 2, "//") == 0)
+    {
+        end = url.find_first_of("/?#", pos + 2);
+        this->authority     = url.substr(pos + 2, end == std::string::npos ? std::string::npos : end - pos - 2);
+        this->hasAuthority  = true;
+        pos = end == std::string::npos ? url.size() : end;
+    }
+
+    end = url.find_first_of("?#", pos);
+    this->path = url.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    pos = end == std::string::npos ? url.size() : end;
+
+    if (pos < url.size() && url.at(pos) == '?')
+    {
+        end = url.find('#', pos);
+        this->query     = url.substr(pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1);
+        this->hasQuery  = true;
+        pos = end == std::string::npos ? url.size() : end;
+    }
+
+    if (pos < url.size())
+    {
+        this->fragment      = url.substr(pos + 1);
+        this->hasFragment   = true;
+    }
+
+    this->SplitAuthority();
+}
+void                Url::Compose            ()
+{
+    this->url.clear();
+    this->url.reserve(this->scheme.size() + this->authority.size() + this->path.size() + this->query.size() + this->fragment.size() + 6);
+
+    if (!this->scheme.empty())
+    {
+        this->url += this->scheme;
+        this->url += ':';
+    }
+    if (this->hasAuthority)
+    {
+        this->url += "//";
+        this->url += this->authority;
+    }
+
+    this->url += this->path;
+
+    if (this->hasQuery)
+    {
+        this->url += '?';
+        this->url += this->query;
+    }
+    if (this->hasFragment)
+    {
+        this->url += '#';
+        this->url += this->fragment;
+    }
+}
+void                Url::SplitAuthority     ()
+{
+    /* [userinfo "@"] host [":" port], the host may be a bracketed ipv6 literal */
+    size_t begin    = this->authority.find('@');
+    begin           = begin == std::string::npos ? 0 : begin + 1;
+    size_t colon    = this->authority.find_last_of(":]");
+
+    this->port = this->scheme == "https" ? 443 : 80;
+
+    if (colon != std::string::npos && colon >= begin && this->authority.at(colon) == ':')
+    {
+        if (colon + 1 < this->authority.size())
+            this->port = strtoul(this->authority.c_str() + colon + 1, NULL, 10);
+        this->host = this->authority.substr(begin, colon - begin);
+    }
+    else
+    {
+        this->host = this->authority.substr(begin);
+    }
+}
+void                Url::RemoveDotSegments  (std::string &path)
+{
+    /* most paths have no dot segments, leave those alone */
+    if (path.find("/.") == std::string::npos && path.compare(0, 1, ".") != 0)
+        return;
+
+    /* RFC 3986, section 5.2.4 */
+    std::string input   = path;
+    std::string output  = "";
+    output.reserve(input.size());
+
+    size_t pos = 0;
+    while (pos < input.size())
+    {
+        if (input.compare(pos, 3, "../") == 0)
+        {
+            pos += 3;
+        }
+        else if (input.compare(pos, 2, "./") == 0)
+        {
+            pos += 2;
+        }
+        else if (input.compare(pos, 3, "/./") == 0)
+        {
+            pos += 2;
+        }
+        else if (input.compare(pos, std::string::npos, "/.") == 0)
+        {
+            input.replace(pos, 2, "/");
+        }
+        else if (input.compare(pos, 4, "/../") == 0 || input.compare(pos, std::string::npos, "/..") == 0)
+        {
+            if (input.compare(pos, 4, "/../") == 0)
+                pos += 3;
+            else
+                input.replace(pos, 3, "/");
+
+            size_t slash = output.find_last_of('/');
+            output.erase(slash == std::string::npos ? 0 : slash);
+        }
+        else if (input.compare(pos, std::string::npos, ".") == 0 || input.compare(pos, std::string::npos, "..") == 0)
+        {
+            pos = input.size();
+        }
+        else
+        {
+            size_t end = input.find('/', pos + 1);
+            if (end == std::string::npos)
+                end = input.size();
+            output.append(input, pos, end - pos);
+            pos = end;
+        }
+    }
+
+    path = output;
+}
@@ -0,0 +1,61 @@
+/*
+ * Url.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef URL_H_
+#define URL_H_
+
+#include "config.h"
+
+namespace dash
+{
+    namespace helpers
+    {
+        /* a url split into its components once, references are resolved against it as in RFC 3986, section 5.2 */
+        class Url
+        {
+            public:
+                Url             ();
+                Url             (const std::string &url);
+                virtual ~Url    ();
+
+                Url                 Resolve         (const std::string &reference) const;
+                Url                 Resolve         (const Url &reference) const;
+                bool                IsHttp          ()  const;
+                const std::string&  ToString        ()  const;
+                const std::string&  GetHost         ()  const;
+                size_t              GetPort         ()  const;
+                std::string         GetPathAndQuery ()  const;
+
+                /* split only, a relative reference keeps its dot segments until it is resolved */
+                static Url          FromReference   (const std::string &reference);
+
+            private:
+                void        Parse               (const std::string &url);
+                void        Compose             ();
+                void        SplitAuthority      ();
+                static void RemoveDotSegments   (std::string &path);
+
+                std::string url;
+                std::string scheme;
+                std::string authority;
+                std::string host;
+                size_t      port;
+                std::string path;
+                std::string query;
+                std::string fragment;
+                bool        hasAuthority;
+                bool        hasQuery;
+                bool        hasFragment;
+        };
+    }
+}
+
+#endif /* URL_H_ */
@@ -17,7 +17,9 @@ using namespace dash::mpd;
 using namespace dash::network;
 using namespace dash::helpers;
 
-DASHManager::DASHManager            ()
+DASHManager::DASHManager            () :
+             conversionThreads          (0),
+             isParseStatisticsEnabled   (false)
 {
 }
 DASHManager::~DASHManager           ()
@@ -27,18 +29,129 @@ IMPD*           DASHManager::Open   (char *path)
 {
     DOMParser parser(path);
 
-    uint32_t fetchTime = Time::GetCurrentUTCTimeInSec();
+    return this->Open(parser);
+}
+IMPD*           DASHManager::Open   (const char *buffer, size_t length, const char *url)
+{
+    DOMParser parser(url, buffer, length);
+
+    return this->Open(parser);
+}
+IMPD*           DASHManager::Open   (const char *buffer, size_t length, const char *url, const char *etag, std::vector<char> &snapshot)
+{
+    DOMParser parser(url, buffer, length);
+
+    parser.RecordSnapshot(etag);
+
+    IMPD *mpd = this->Open(parser);
+
+    snapshot.clear();
+    if (mpd)
+        parser.WriteSnapshot(snapshot);
+
+    return mpd;
+}
+IMPD*           DASHManager::OpenSnapshot   (const char *snapshot, size_t length, const char *url, const char *etag)
+{
+    uint64_t                    start       = Time::GetMonotonicTimeInUs();
+    uint32_t                    fetchTime   = Time::GetCurrentUTCTimeInSec();
+    metrics::ParseStatistics    *statistics = this->isParseStatisticsEnabled ? new metrics::ParseStatistics() : NULL;
+
+    DOMParser parser(url);
+
+    parser.SetConversionThreads(this->conversionThreads);
+    parser.SetStatistics(statistics);
+
+    if (!parser.ParseSnapshot(snapshot, length, etag))
+    {
+        delete(statistics);
+        return NULL;
+    }
+
+    return this->Convert(parser, fetchTime, start, statistics);
+}
+IMPD*           DASHManager::Open   (DOMParser& parser)
+{
+    uint64_t                    start       = Time::GetMonotonicTimeInUs();
+    uint32_t                    fetchTime   = Time::GetCurrentUTCTimeInSec();
+    metrics::ParseStatistics    *statistics = this->isParseStatisticsEnabled ? new metrics::ParseStatistics() : NULL;
+
+    parser.SetConversionThreads(this->conversionThreads);
+    parser.SetStatistics(statistics);
 
     if (!parser.Parse())
+    {
+        delete(statistics);
         return NULL;
+    }
+
+    return this->Convert(parser, fetchTime, start, statistics);
+}
+IMPD*           DASHManager::Convert    (DOMParser& parser, uint32_t fetchTime, uint64_t start, metrics::ParseStatistics *statistics)
+{
+    uint64_t conversionStart = Time::GetMonotonicTimeInUs();
 
     MPD* mpd = parser.GetRootNode()->ToMPD();
 
-    if (mpd)
-        mpd->SetFetchTime(fetchTime);
+    if (!mpd)
+    {
+        delete(statistics);
+        return NULL;
+    }
+
+    mpd->SetFetchTime(fetchTime);
+
+    if (statistics)
+        statistics->AddConversionTime(Time::GetMonotonicTimeInUs() - conversionStart);
 
+    this->xlinks.ResolveOnLoad(mpd);
+
+    if (statistics)
+        statistics->SetTotalTime(Time::GetMonotonicTimeInUs() - start);
+
+    mpd->SetParseStatistics(statistics);
     return mpd;
 }
+IMPDUpdate*     DASHManager::Update (IMPD *mpd, const char *buffer, size_t length, const char *url)
+{
+    DOMParser parser(url, buffer, length);
+
+    MPD *newer = (MPD *) this->Open(parser);
+
+    if (!newer)
+        return NULL;
+
+    MPDUpdate *update = new MPDUpdate();
+
+    ((MPD *) mpd)->Merge(*newer, *update);
+
+    delete(newer);
+    return update;
+}
+IMPDUpdate*     DASHManager::ResolveXLink   (IMPD *mpd, IMPDElement *element)
+{
+    MPDUpdate *update = new MPDUpdate();
+
+    if (!this->xlinks.Resolve((MPD *) mpd, element, *update))
+    {
+        delete(update);
+        return NULL;
+    }
+
+    return update;
+}
+void            DASHManager::SetConversionThreads   (uint32_t threads)
+{
+    this->conversionThreads = threads;
+}
+void            DASHManager::SetParseStatistics     (bool enable)
+{
+    this->isParseStatisticsEnabled = enable;
+}
+void            DASHManager::SetXLinkConnection     (IConnection *connection)
+{
+    this->xlinks.SetConnection(connection);
+}
 void            DASHManager::Delete ()
 {
     delete this;
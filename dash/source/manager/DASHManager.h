@@ -16,8 +16,11 @@
 
 #include "../xml/Node.h"
 #include "../xml/DOMParser.h"
+#include "../xml/XLinkResolver.h"
 #include "IDASHManager.h"
 #include "../helpers/Time.h"
+#include "../mpd/MPDUpdate.h"
+#include "../metrics/ParseStatistics.h"
 
 namespace dash
 {
@@ -27,8 +30,24 @@ namespace dash
             DASHManager             ();
             virtual ~DASHManager    ();
 
-            mpd::IMPD*  Open    (char *path);
-            void        Delete  ();
+            mpd::IMPD*          Open                    (char *path);
+            mpd::IMPD*          Open                    (const char *buffer, size_t length, const char *url);
+            mpd::IMPD*          Open                    (const char *buffer, size_t length, const char *url, const char *etag, std::vector<char> &snapshot);
+            mpd::IMPD*          OpenSnapshot            (const char *snapshot, size_t length, const char *url, const char *etag);
+            mpd::IMPDUpdate*    Update                  (mpd::IMPD *mpd, const char *buffer, size_t length, const char *url);
+            mpd::IMPDUpdate*    ResolveXLink            (mpd::IMPD *mpd, mpd::IMPDElement *element);
+            void                SetConversionThreads    (uint32_t threads);
+            void                SetParseStatistics      (bool enable);
+            void                SetXLinkConnection      (network::IConnection *connection);
+            void                Delete                  ();
+
+        private:
+            mpd::IMPD*          Open                    (xml::DOMParser& parser);
+            mpd::IMPD*          Convert                 (xml::DOMParser& parser, uint32_t fetchTime, uint64_t start, metrics::ParseStatistics *statistics);
+
+            uint32_t            conversionThreads;
+            bool                isParseStatisticsEnabled;
+            xml::XLinkResolver  xlinks;
     };
 }
 
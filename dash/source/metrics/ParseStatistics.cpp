@@ -0,0 +1,85 @@
+/*
+ * ParseStatistics.cpp
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ParseStatistics.h"
+
+using namespace dash::metrics;
+
+ParseStatistics::ParseStatistics    () :
+                 documentSize       (0),
+                 nodeCount          (0),
+                 attributeCount     (0),
+                 readTime           (0),
+                 buildTime          (0),
+                 conversionTime     (0),
+                 totalTime          (0)
+{
+}
+ParseStatistics::~ParseStatistics   ()
+{
+}
+
+uint64_t    ParseStatistics::GetDocumentSize    () const
+{
+    return this->documentSize;
+}
+void        ParseStatistics::SetDocumentSize    (uint64_t documentSize)
+{
+    this->documentSize = documentSize;
+}
+uint64_t    ParseStatistics::GetNodeCount       () const
+{
+    return this->nodeCount;
+}
+void        ParseStatistics::AddNode            ()
+{
+    this->nodeCount++;
+}
+uint64_t    ParseStatistics::GetAttributeCount  () const
+{
+    return this->attributeCount;
+}
+void        ParseStatistics::AddAttribute       ()
+{
+    this->attributeCount++;
+}
+uint64_t    ParseStatistics::GetReadTime        () const
+{
+    return this->readTime;
+}
+void        ParseStatistics::AddReadTime        (uint64_t time)
+{
+    this->readTime += time;
+}
+uint64_t    ParseStatistics::GetBuildTime       () const
+{
+    return this->buildTime;
+}
+void        ParseStatistics::AddBuildTime       (uint64_t time)
+{
+    this->buildTime += time;
+}
+uint64_t    ParseStatistics::GetConversionTime  () const
+{
+    return this->conversionTime;
+}
+void        ParseStatistics::AddConversionTime  (uint64_t time)
+{
+    this->conversionTime += time;
+}
+uint64_t    ParseStatistics::GetTotalTime       () const
+{
+    return this->totalTime;
+}
+void        ParseStatistics::SetTotalTime       (uint64_t time)
+{
+    this->totalTime = time;
+}
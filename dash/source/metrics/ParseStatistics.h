@@ -0,0 +1,55 @@
+/*
+ * ParseStatistics.h
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PARSESTATISTICS_H_
+#define PARSESTATISTICS_H_
+
+#include "IParseStatistics.h"
+
+namespace dash
+{
+    namespace metrics
+    {
+        class ParseStatistics : public IParseStatistics
+        {
+            public:
+                ParseStatistics             ();
+                virtual ~ParseStatistics    ();
+
+                uint64_t    GetDocumentSize     () const;
+                uint64_t    GetNodeCount        () const;
+                uint64_t    GetAttributeCount   () const;
+                uint64_t    GetReadTime         () const;
+                uint64_t    GetBuildTime        () const;
+                uint64_t    GetConversionTime   () const;
+                uint64_t    GetTotalTime        () const;
+
+                void    SetDocumentSize     (uint64_t documentSize);
+                void    AddNode             ();
+                void    AddAttribute        ();
+                void    AddReadTime         (uint64_t time);
+                void    AddBuildTime        (uint64_t time);
+                void    AddConversionTime   (uint64_t time);
+                void    SetTotalTime        (uint64_t time);
+
+            private:
+                uint64_t    documentSize;
+                uint64_t    nodeCount;
+                uint64_t    attributeCount;
+                uint64_t    readTime;
+                uint64_t    buildTime;
+                uint64_t    conversionTime;
+                uint64_t    totalTime;
+        };
+    }
+}
+
+#endif /* PARSESTATISTICS_H_ */
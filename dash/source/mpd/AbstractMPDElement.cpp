@@ -23,19 +23,27 @@ AbstractMPDElement::~AbstractMPDElement     ()
         delete(this->additionalSubNodes.at(i));
 }
 
-const std::vector<INode *>                  AbstractMPDElement::GetAdditionalSubNodes   ()  const
+const std::vector<INode *>&                 AbstractMPDElement::GetAdditionalSubNodes   ()  const
 {
     return this->additionalSubNodes;
 }
-const std::map<std::string, std::string>    AbstractMPDElement::GetRawAttributes        ()  const
+const std::map<std::string, std::string>&   AbstractMPDElement::GetRawAttributes        ()  const
 {
+    /* built while the element was, so readers on any thread take no lock */
     return this->rawAttributes;
 }
 void                                        AbstractMPDElement::AddAdditionalSubNode    (INode *node)
 {
     this->additionalSubNodes.push_back(node);
 }
-void                                        AbstractMPDElement::AddRawAttributes        (std::map<std::string, std::string> attributes)
+void                                        AbstractMPDElement::AddRawAttributes        (std::vector<std::pair<std::string, std::string> >& attributes)
 {
-    this->rawAttributes = attributes;
+    /* the values are taken over, the parser doesn't need them anymore, an attribute given twice keeps its first value */
+    for (size_t i = 0; i < attributes.size(); i++)
+    {
+        std::pair<std::map<std::string, std::string>::iterator, bool> entry = this->rawAttributes.insert(std::make_pair(attributes.at(i).first, std::string()));
+
+        if (entry.second)
+            entry.first->second.swap(attributes.at(i).second);
+    }
 }
\ No newline at end of file
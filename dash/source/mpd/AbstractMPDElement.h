@@ -26,10 +26,10 @@ namespace dash
                 AbstractMPDElement          ();
                 virtual ~AbstractMPDElement ();
 
-                virtual const std::vector<xml::INode *>             GetAdditionalSubNodes   ()  const;
-                virtual const std::map<std::string, std::string>    GetRawAttributes        ()  const;
+                virtual const std::vector<xml::INode *>&            GetAdditionalSubNodes   ()  const;
+                virtual const std::map<std::string, std::string>&   GetRawAttributes        ()  const;
                 virtual void                                        AddAdditionalSubNode    (xml::INode * node);
-                virtual void                                        AddRawAttributes        (std::map<std::string, std::string> attributes);
+                virtual void                                        AddRawAttributes        (std::vector<std::pair<std::string, std::string> >& attributes);
 
             private:
                 std::vector<xml::INode *>           additionalSubNodes;
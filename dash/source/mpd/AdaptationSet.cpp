@@ -341,3 +341,42 @@ void                                    AdaptationSet::SetBitstreamSwitching
 {
     this->isBitstreamSwitching = value;
 }
+void                                    AdaptationSet::Merge                            (AdaptationSet& newer, MPDUpdate& update)
+{
+    RepresentationBase::Merge(newer, update);
+
+    update.Replace(this->accessibility, newer.accessibility);
+    update.Replace(this->role, newer.role);
+    update.Replace(this->rating, newer.rating);
+    update.Replace(this->viewpoint, newer.viewpoint);
+    update.Replace(this->contentComponent, newer.contentComponent);
+    update.Replace(this->baseURLs, newer.baseURLs);
+    update.Merge(this->segmentBase, newer.segmentBase);
+    update.Merge(this->segmentList, newer.segmentList);
+    update.Merge(this->segmentTemplate, newer.segmentTemplate);
+    update.Merge(this->representation, newer.representation);
+
+    this->xlinkHref                 = newer.xlinkHref;
+    this->xlinkActuate              = newer.xlinkActuate;
+    this->id                        = newer.id;
+    this->group                     = newer.group;
+    this->lang                      = newer.lang;
+    this->contentType               = newer.contentType;
+    this->par                       = newer.par;
+    this->minBandwidth              = newer.minBandwidth;
+    this->maxBandwidth              = newer.maxBandwidth;
+    this->minWidth                  = newer.minWidth;
+    this->maxWidth                  = newer.maxWidth;
+    this->minHeight                 = newer.minHeight;
+    this->maxHeight                 = newer.maxHeight;
+    this->minFramerate              = newer.minFramerate;
+    this->maxFramerate              = newer.maxFramerate;
+    this->segmentAlignmentIsBool    = newer.segmentAlignmentIsBool;
+    this->subsegmentAlignmentIsBool = newer.subsegmentAlignmentIsBool;
+    this->usesSegmentAlignment      = newer.usesSegmentAlignment;
+    this->usesSubsegmentAlignment   = newer.usesSubsegmentAlignment;
+    this->segmentAlignment          = newer.segmentAlignment;
+    this->subsegmentAlignment       = newer.subsegmentAlignment;
+    this->subsegmentStartsWithSAP   = newer.subsegmentStartsWithSAP;
+    this->isBitstreamSwitching      = newer.isBitstreamSwitching;
+}
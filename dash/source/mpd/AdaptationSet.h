@@ -96,6 +96,7 @@ namespace dash
                 void    SetSubsegmentAlignment      (const std::string& subsegmentAlignment);
                 void    SetSubsegmentStartsWithSAP  (uint8_t subsegmentStartsWithSAP);
                 void    SetBitstreamSwitching       (bool value);
+                void    Merge                       (AdaptationSet& newer, MPDUpdate& update);
 
             private:
                 std::vector<Descriptor *>       accessibility;
@@ -29,7 +29,9 @@ const std::string&  BaseUrl::GetUrl             ()  const
 }
 void                BaseUrl::SetUrl             (const std::string& url)
 {
-    this->url = url;
+    /* split once here, every segment resolved against this url reuses it */
+    this->url       = url;
+    this->reference = dash::helpers::Url::FromReference(url);
 }
 const std::string&  BaseUrl::GetServiceLocation ()  const
 {
@@ -47,6 +49,10 @@ void                BaseUrl::SetByteRange       (const std::string& byteRange)
 {
     this->byteRange = byteRange;
 }
+const dash::helpers::Url&   BaseUrl::GetReference   ()  const
+{
+    return this->reference;
+}
 ISegment*           BaseUrl::ToMediaSegment     (const std::vector<IBaseUrl *>& baseurls) const
 {
     Segment *seg = new Segment();
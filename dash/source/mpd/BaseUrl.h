@@ -38,10 +38,13 @@ namespace dash
 
                 virtual ISegment* ToMediaSegment (const std::vector<IBaseUrl *>& baseurls) const;
 
+                const helpers::Url& GetReference () const;
+
             private:
-                std::string url;
-                std::string serviceLocation;
-                std::string byteRange;
+                std::string     url;
+                helpers::Url    reference;
+                std::string     serviceLocation;
+                std::string     byteRange;
         };
     }
 }
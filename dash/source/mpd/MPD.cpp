@@ -11,6 +11,8 @@
 
 #include "MPD.h"
 
+#include <algorithm>
+
 using namespace dash::mpd;
 using namespace dash::metrics;
 
@@ -25,7 +27,17 @@ MPD::MPD    () :
         timeShiftBufferDepth(""),
         suggestedPresentationDelay(""),
         maxSegmentDuration(""),
-        maxSubsegmentDuration("")
+        maxSubsegmentDuration(""),
+        availabilityStarttimeInMs(-1),
+        availabilityEndtimeInMs(-1),
+        mediaPresentationDurationInMs(-1),
+        minimumUpdatePeriodInMs(-1),
+        minBufferTimeInMs(-1),
+        timeShiftBufferDepthInMs(-1),
+        suggestedPresentationDelayInMs(-1),
+        maxSegmentDurationInMs(-1),
+        maxSubsegmentDurationInMs(-1),
+        parseStatistics(NULL)
 {
 }
 MPD::~MPD   ()
@@ -38,6 +50,8 @@ MPD::~MPD   ()
         delete(this->periods.at(i));
     for(size_t i = 0; i < this->baseUrls.size(); i++)
         delete(this->baseUrls.at(i));
+
+    delete(this->parseStatistics);
 }
 
 const std::vector<IProgramInformation *>&   MPD::GetProgramInformations             () const 
@@ -72,6 +86,18 @@ void                                        MPD::AddPeriod
 {
     this->periods.push_back(period);
 }
+bool                                        MPD::ReplacePeriod                      (Period *period, const std::vector<Period *>& periods)
+{
+    /* the caller owns the period from now on */
+    std::vector<Period *>::iterator it = std::find(this->periods.begin(), this->periods.end(), period);
+
+    if (it == this->periods.end())
+        return false;
+
+    it = this->periods.erase(it);
+    this->periods.insert(it, periods.begin(), periods.end());
+    return true;
+}
 const std::vector<IMetrics *>&              MPD::GetMetrics                         () const 
 {
     return (std::vector<IMetrics *> &) this->metrics;
@@ -111,6 +137,11 @@ const std::string&                          MPD::GetAvailabilityStarttime
 void                                        MPD::SetAvailabilityStarttime           (const std::string& availabilityStarttime)
 {
     this->availabilityStarttime = availabilityStarttime;
+    this->availabilityStarttimeInMs = dash::helpers::Time::ParseDateTime(availabilityStarttime);
+}
+int64_t                                     MPD::GetAvailabilityStarttimeInMs       ()  const
+{
+    return this->availabilityStarttimeInMs;
 }
 const std::string&                          MPD::GetAvailabilityEndtime             ()  const
 {
@@ -119,6 +150,11 @@ const std::string&                          MPD::GetAvailabilityEndtime
 void                                        MPD::SetAvailabilityEndtime             (const std::string& availabilityEndtime)
 {
     this->availabilityEndtime = availabilityEndtime;
+    this->availabilityEndtimeInMs = dash::helpers::Time::ParseDateTime(availabilityEndtime);
+}
+int64_t                                     MPD::GetAvailabilityEndtimeInMs         ()  const
+{
+    return this->availabilityEndtimeInMs;
 }
 const std::string&                          MPD::GetMediaPresentationDuration       ()  const
 {
@@ -127,6 +163,11 @@ const std::string&                          MPD::GetMediaPresentationDuration
 void                                        MPD::SetMediaPresentationDuration       (const std::string& mediaPresentationDuration)
 {
     this->mediaPresentationDuration = mediaPresentationDuration;
+    this->mediaPresentationDurationInMs = dash::helpers::Time::ParseDuration(mediaPresentationDuration);
+}
+int64_t                                     MPD::GetMediaPresentationDurationInMs   ()  const
+{
+    return this->mediaPresentationDurationInMs;
 }
 const std::string&                          MPD::GetMinimumUpdatePeriod             ()  const
 {
@@ -135,6 +176,11 @@ const std::string&                          MPD::GetMinimumUpdatePeriod
 void                                        MPD::SetMinimumUpdatePeriod             (const std::string& minimumUpdatePeriod)
 {
     this->minimumUpdatePeriod = minimumUpdatePeriod;
+    this->minimumUpdatePeriodInMs = dash::helpers::Time::ParseDuration(minimumUpdatePeriod);
+}
+int64_t                                     MPD::GetMinimumUpdatePeriodInMs         ()  const
+{
+    return this->minimumUpdatePeriodInMs;
 }
 const std::string&                          MPD::GetMinBufferTime                   ()  const
 {
@@ -143,6 +189,11 @@ const std::string&                          MPD::GetMinBufferTime
 void                                        MPD::SetMinBufferTime                   (const std::string& minBufferTime)
 {
     this->minBufferTime = minBufferTime;
+    this->minBufferTimeInMs = dash::helpers::Time::ParseDuration(minBufferTime);
+}
+int64_t                                     MPD::GetMinBufferTimeInMs               ()  const
+{
+    return this->minBufferTimeInMs;
 }
 const std::string&                          MPD::GetTimeShiftBufferDepth            ()  const
 {
@@ -151,6 +202,11 @@ const std::string&                          MPD::GetTimeShiftBufferDepth
 void                                        MPD::SetTimeShiftBufferDepth            (const std::string& timeShiftBufferDepth)
 {
     this->timeShiftBufferDepth = timeShiftBufferDepth;
+    this->timeShiftBufferDepthInMs = dash::helpers::Time::ParseDuration(timeShiftBufferDepth);
+}
+int64_t                                     MPD::GetTimeShiftBufferDepthInMs        ()  const
+{
+    return this->timeShiftBufferDepthInMs;
 }
 const std::string&                          MPD::GetSuggestedPresentationDelay      ()  const
 {
@@ -159,6 +215,11 @@ const std::string&                          MPD::GetSuggestedPresentationDelay
 void                                        MPD::SetSuggestedPresentationDelay      (const std::string& suggestedPresentationDelay)
 {
     this->suggestedPresentationDelay = suggestedPresentationDelay;
+    this->suggestedPresentationDelayInMs = dash::helpers::Time::ParseDuration(suggestedPresentationDelay);
+}
+int64_t                                     MPD::GetSuggestedPresentationDelayInMs  ()  const
+{
+    return this->suggestedPresentationDelayInMs;
 }
 const std::string&                          MPD::GetMaxSegmentDuration              ()  const
 {
@@ -167,6 +228,11 @@ const std::string&                          MPD::GetMaxSegmentDuration
 void                                        MPD::SetMaxSegmentDuration              (const std::string& maxSegmentDuration)
 {
     this->maxSegmentDuration = maxSegmentDuration;
+    this->maxSegmentDurationInMs = dash::helpers::Time::ParseDuration(maxSegmentDuration);
+}
+int64_t                                     MPD::GetMaxSegmentDurationInMs          ()  const
+{
+    return this->maxSegmentDurationInMs;
 }
 const std::string&                          MPD::GetMaxSubsegmentDuration           ()  const
 {
@@ -175,6 +241,11 @@ const std::string&                          MPD::GetMaxSubsegmentDuration
 void                                        MPD::SetMaxSubsegmentDuration           (const std::string& maxSubsegmentDuration)
 {
     this->maxSubsegmentDuration = maxSubsegmentDuration;
+    this->maxSubsegmentDurationInMs = dash::helpers::Time::ParseDuration(maxSubsegmentDuration);
+}
+int64_t                                     MPD::GetMaxSubsegmentDurationInMs       ()  const
+{
+    return this->maxSubsegmentDurationInMs;
 }
 IBaseUrl*                                   MPD::GetMPDPathBaseUrl                  ()  const
 {
@@ -192,6 +263,50 @@ void                                        MPD::SetFetchTime
 {
     this->fetchTime = fetchTimeInSec;
 }
+const IParseStatistics*                     MPD::GetParseStatistics                 ()  const
+{
+    return this->parseStatistics;
+}
+void                                        MPD::SetParseStatistics                 (ParseStatistics *parseStatistics)
+{
+    delete(this->parseStatistics);
+    this->parseStatistics = parseStatistics;
+}
+void                                        MPD::Merge                              (MPD& newer, MPDUpdate& update)
+{
+    /* everything the revision describes as before keeps its address, see IMPDUpdate */
+    update.Replace(this->programInformations, newer.programInformations);
+    update.Replace(this->baseUrls, newer.baseUrls);
+    update.Merge(this->periods, newer.periods);
+    update.Replace(this->metrics, newer.metrics);
+    update.Replace(this->mpdPathBaseUrl, newer.mpdPathBaseUrl);
+
+    this->locations                         = newer.locations;
+    this->id                                = newer.id;
+    this->profiles                          = newer.profiles;
+    this->type                              = newer.type;
+    this->availabilityStarttime             = newer.availabilityStarttime;
+    this->availabilityEndtime               = newer.availabilityEndtime;
+    this->mediaPresentationDuration         = newer.mediaPresentationDuration;
+    this->minimumUpdatePeriod               = newer.minimumUpdatePeriod;
+    this->minBufferTime                     = newer.minBufferTime;
+    this->timeShiftBufferDepth              = newer.timeShiftBufferDepth;
+    this->suggestedPresentationDelay        = newer.suggestedPresentationDelay;
+    this->maxSegmentDuration                = newer.maxSegmentDuration;
+    this->maxSubsegmentDuration             = newer.maxSubsegmentDuration;
+    this->availabilityStarttimeInMs         = newer.availabilityStarttimeInMs;
+    this->availabilityEndtimeInMs           = newer.availabilityEndtimeInMs;
+    this->mediaPresentationDurationInMs     = newer.mediaPresentationDurationInMs;
+    this->minimumUpdatePeriodInMs           = newer.minimumUpdatePeriodInMs;
+    this->minBufferTimeInMs                 = newer.minBufferTimeInMs;
+    this->timeShiftBufferDepthInMs          = newer.timeShiftBufferDepthInMs;
+    this->suggestedPresentationDelayInMs    = newer.suggestedPresentationDelayInMs;
+    this->maxSegmentDurationInMs            = newer.maxSegmentDurationInMs;
+    this->maxSubsegmentDurationInMs         = newer.maxSubsegmentDurationInMs;
+    this->fetchTime                         = newer.fetchTime;
+
+    std::swap(this->parseStatistics, newer.parseStatistics);
+}
 
 
 const std::vector<ITCPConnection *>&        MPD::GetTCPConnectionList    () const
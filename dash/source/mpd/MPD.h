@@ -22,6 +22,8 @@
 #include "AbstractMPDElement.h"
 #include "../metrics/HTTPTransaction.h"
 #include "../metrics/TCPConnection.h"
+#include "../metrics/ParseStatistics.h"
+#include "../helpers/Time.h"
 
 namespace dash
 {
@@ -52,6 +54,16 @@ namespace dash
                 const std::string&                          GetMaxSubsegmentDuration        ()  const;
                 IBaseUrl*                                   GetMPDPathBaseUrl               ()  const;
                 uint32_t                                    GetFetchTime                    ()  const;
+                int64_t                                     GetAvailabilityStarttimeInMs        ()  const;
+                int64_t                                     GetAvailabilityEndtimeInMs          ()  const;
+                int64_t                                     GetMediaPresentationDurationInMs    ()  const;
+                int64_t                                     GetMinimumUpdatePeriodInMs          ()  const;
+                int64_t                                     GetMinBufferTimeInMs                ()  const;
+                int64_t                                     GetTimeShiftBufferDepthInMs         ()  const;
+                int64_t                                     GetSuggestedPresentationDelayInMs   ()  const;
+                int64_t                                     GetMaxSegmentDurationInMs           ()  const;
+                int64_t                                     GetMaxSubsegmentDurationInMs        ()  const;
+                const dash::metrics::IParseStatistics*      GetParseStatistics              ()  const;
 
                 const std::vector<dash::metrics::ITCPConnection *>&     GetTCPConnectionList    () const;
                 const std::vector<dash::metrics::IHTTPTransaction *>&   GetHTTPTransactionList  () const;
@@ -62,6 +74,7 @@ namespace dash
                 void    AddBaseUrl                      (BaseUrl *url);
                 void    AddLocation                     (const std::string& location);
                 void    AddPeriod                       (Period *period);
+                bool    ReplacePeriod                   (Period *period, const std::vector<Period *>& periods);
                 void    AddMetrics                      (Metrics *metrics);
                 void    SetId                           (const std::string& id);
                 void    SetProfiles                     (const std::string& profiles);
@@ -77,6 +90,8 @@ namespace dash
                 void    SetMaxSubsegmentDuration        (const std::string& maxSubsegmentDuration);
                 void    SetMPDPathBaseUrl               (BaseUrl *path);
                 void    SetFetchTime                    (uint32_t fetchTimeInSec);
+                void    SetParseStatistics              (dash::metrics::ParseStatistics *parseStatistics);
+                void    Merge                           (MPD& newer, MPDUpdate& update);
 
             private:
                 std::vector<ProgramInformation *>   programInformations;
@@ -96,8 +111,18 @@ namespace dash
                 std::string                         suggestedPresentationDelay;
                 std::string                         maxSegmentDuration;
                 std::string                         maxSubsegmentDuration;
+                int64_t                             availabilityStarttimeInMs;
+                int64_t                             availabilityEndtimeInMs;
+                int64_t                             mediaPresentationDurationInMs;
+                int64_t                             minimumUpdatePeriodInMs;
+                int64_t                             minBufferTimeInMs;
+                int64_t                             timeShiftBufferDepthInMs;
+                int64_t                             suggestedPresentationDelayInMs;
+                int64_t                             maxSegmentDurationInMs;
+                int64_t                             maxSubsegmentDurationInMs;
                 BaseUrl                             *mpdPathBaseUrl;
                 uint32_t                            fetchTime;
+                dash::metrics::ParseStatistics      *parseStatistics;
 
                 std::vector<dash::metrics::TCPConnection *>     tcpConnections;
                 std::vector<dash::metrics::HTTPTransaction *>   httpTransactions;
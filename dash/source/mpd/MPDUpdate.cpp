@@ -0,0 +1,96 @@
+/*
+ * MPDUpdate.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "MPDUpdate.h"
+#include "Period.h"
+
+using namespace dash::mpd;
+
+MPDUpdate::MPDUpdate    ()
+{
+}
+MPDUpdate::~MPDUpdate   ()
+{
+    for (size_t i = 0; i < this->retired.size(); i++)
+        delete(this->retired.at(i));
+}
+
+const std::vector<IPeriod *>&           MPDUpdate::GetAddedPeriods              ()  const
+{
+    return this->addedPeriods;
+}
+const std::vector<IPeriod *>&           MPDUpdate::GetRemovedPeriods            ()  const
+{
+    return this->removedPeriods;
+}
+const std::vector<IAdaptationSet *>&    MPDUpdate::GetAddedAdaptationSets       ()  const
+{
+    return this->addedAdaptationSets;
+}
+const std::vector<IAdaptationSet *>&    MPDUpdate::GetRemovedAdaptationSets     ()  const
+{
+    return this->removedAdaptationSets;
+}
+const std::vector<IRepresentation *>&   MPDUpdate::GetAddedRepresentations      ()  const
+{
+    return this->addedRepresentations;
+}
+const std::vector<IRepresentation *>&   MPDUpdate::GetRemovedRepresentations    ()  const
+{
+    return this->removedRepresentations;
+}
+const std::vector<ISegmentTimeline *>&  MPDUpdate::GetChangedSegmentTimelines   ()  const
+{
+    return this->changedSegmentTimelines;
+}
+void                                    MPDUpdate::ChangeSegmentTimeline        (SegmentTimeline *segmentTimeline)
+{
+    this->changedSegmentTimelines.push_back(segmentTimeline);
+}
+void                                    MPDUpdate::Retire                       (IMPDElement *element)
+{
+    this->retired.push_back(element);
+}
+bool                                    MPDUpdate::HasId                        (const std::string& id)
+{
+    return !id.empty();
+}
+bool                                    MPDUpdate::HasId                        (uint32_t id)
+{
+    return id != 0;
+}
+void                                    MPDUpdate::Add                          (Period *period)
+{
+    this->addedPeriods.push_back(period);
+}
+void                                    MPDUpdate::Add                          (AdaptationSet *adaptationSet)
+{
+    this->addedAdaptationSets.push_back(adaptationSet);
+}
+void                                    MPDUpdate::Add                          (Representation *representation)
+{
+    this->addedRepresentations.push_back(representation);
+}
+void                                    MPDUpdate::Remove                       (Period *period)
+{
+    this->removedPeriods.push_back(period);
+    this->Retire(period);
+}
+void                                    MPDUpdate::Remove                       (AdaptationSet *adaptationSet)
+{
+    this->removedAdaptationSets.push_back(adaptationSet);
+    this->Retire(adaptationSet);
+}
+void                                    MPDUpdate::Remove                       (Representation *representation)
+{
+    this->removedRepresentations.push_back(representation);
+    this->Retire(representation);
+}
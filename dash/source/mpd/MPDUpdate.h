@@ -0,0 +1,143 @@
+/*
+ * MPDUpdate.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MPDUPDATE_H_
+#define MPDUPDATE_H_
+
+#include "config.h"
+
+#include "IMPDUpdate.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class Period;
+        class AdaptationSet;
+        class Representation;
+        class SegmentTimeline;
+
+        /* collects what merging a revision into an MPD changed, and owns everything the merge took out of it */
+        class MPDUpdate : public IMPDUpdate
+        {
+            public:
+                MPDUpdate           ();
+                virtual ~MPDUpdate  ();
+
+                const std::vector<IPeriod *>&           GetAddedPeriods             ()  const;
+                const std::vector<IPeriod *>&           GetRemovedPeriods           ()  const;
+                const std::vector<IAdaptationSet *>&    GetAddedAdaptationSets      ()  const;
+                const std::vector<IAdaptationSet *>&    GetRemovedAdaptationSets    ()  const;
+                const std::vector<IRepresentation *>&   GetAddedRepresentations     ()  const;
+                const std::vector<IRepresentation *>&   GetRemovedRepresentations   ()  const;
+                const std::vector<ISegmentTimeline *>&  GetChangedSegmentTimelines  ()  const;
+
+                void    Add                     (Period *period);
+                void    Add                     (AdaptationSet *adaptationSet);
+                void    Add                     (Representation *representation);
+                void    Remove                  (Period *period);
+                void    Remove                  (AdaptationSet *adaptationSet);
+                void    Remove                  (Representation *representation);
+                void    ChangeSegmentTimeline   (SegmentTimeline *segmentTimeline);
+                void    Retire                  (IMPDElement *element);
+
+                /* the newer elements take the place of the current ones, which are retired */
+                template <class T> void Replace (std::vector<T *>& current, std::vector<T *>& newer)
+                {
+                    for (size_t i = 0; i < current.size(); i++)
+                        this->Retire(current.at(i));
+
+                    current.swap(newer);
+                    newer.clear();
+                }
+                template <class T> void Replace (T *&current, T *&newer)
+                {
+                    if (current == newer)
+                        return;
+
+                    if (current)
+                        this->Retire(current);
+
+                    current = newer;
+                    newer   = NULL;
+                }
+
+                /* an element present on both sides is merged in place, otherwise it is replaced */
+                template <class T> void Merge   (T *&current, T *&newer)
+                {
+                    if (current && newer)
+                        current->Merge(*newer, *this);
+                    else
+                        this->Replace(current, newer);
+                }
+
+                /* elements are matched by their id, or by position if neither has one, matches are merged in place and keep their address */
+                template <class T> void Merge   (std::vector<T *>& current, std::vector<T *>& newer)
+                {
+                    std::vector<T *> merged;
+                    merged.reserve(newer.size());
+
+                    for (size_t i = 0; i < newer.size(); i++)
+                    {
+                        size_t match = MPDUpdate::Match(current, newer.at(i), i);
+
+                        if (match < current.size())
+                        {
+                            current.at(match)->Merge(*newer.at(i), *this);
+                            merged.push_back(current.at(match));
+                            current.at(match) = NULL;
+                        }
+                        else
+                        {
+                            merged.push_back(newer.at(i));
+                            this->Add(newer.at(i));
+                            newer.at(i) = NULL;
+                        }
+                    }
+
+                    for (size_t i = 0; i < current.size(); i++)
+                        if (current.at(i))
+                            this->Remove(current.at(i));
+
+                    current.swap(merged);
+                }
+
+            private:
+                template <class T> static size_t Match (const std::vector<T *>& current, const T *element, size_t position)
+                {
+                    for (size_t i = 0; i < current.size(); i++)
+                    {
+                        if (current.at(i) == NULL)
+                            continue;
+
+                        if (MPDUpdate::HasId(element->GetId()) ? current.at(i)->GetId() == element->GetId() : i == position && !MPDUpdate::HasId(current.at(i)->GetId()))
+                            return i;
+                    }
+
+                    return current.size();
+                }
+
+                static bool HasId   (const std::string& id);
+                static bool HasId   (uint32_t id);
+
+                std::vector<IPeriod *>          addedPeriods;
+                std::vector<IPeriod *>          removedPeriods;
+                std::vector<IAdaptationSet *>   addedAdaptationSets;
+                std::vector<IAdaptationSet *>   removedAdaptationSets;
+                std::vector<IRepresentation *>  addedRepresentations;
+                std::vector<IRepresentation *>  removedRepresentations;
+                std::vector<ISegmentTimeline *> changedSegmentTimelines;
+                std::vector<IMPDElement *>      retired;
+        };
+    }
+}
+
+#endif /* MPDUPDATE_H_ */
@@ -42,19 +42,41 @@ void                        MultipleSegmentBase::SetBitstreamSwitching  (URLType
 {
     this->bitstreamSwitching = bitstreamSwitching;
 }
-uint32_t                    MultipleSegmentBase::GetDuration            ()  const
+uint64_t                    MultipleSegmentBase::GetDuration            ()  const
 {
     return this->duration;
 }
-void                        MultipleSegmentBase::SetDuration            (uint32_t duration)
+void                        MultipleSegmentBase::SetDuration            (uint64_t duration)
 {
     this->duration = duration;
 }
-uint32_t                    MultipleSegmentBase::GetStartNumber         ()  const
+uint64_t                    MultipleSegmentBase::GetStartNumber         ()  const
 {
     return this->startNumber;
 }
-void                        MultipleSegmentBase::SetStartNumber         (uint32_t startNumber)
+void                        MultipleSegmentBase::SetStartNumber         (uint64_t startNumber)
 {
     this->startNumber = startNumber;
 }
+void                        MultipleSegmentBase::Merge                  (MultipleSegmentBase& newer, MPDUpdate& update)
+{
+    SegmentBase::Merge(newer, update);
+
+    if (this->segmentTimeline && newer.segmentTimeline)
+    {
+        if (this->segmentTimeline->Merge(*newer.segmentTimeline, update))
+            update.ChangeSegmentTimeline(this->segmentTimeline);
+    }
+    else if (this->segmentTimeline || newer.segmentTimeline)
+    {
+        update.Replace(this->segmentTimeline, newer.segmentTimeline);
+
+        if (this->segmentTimeline)
+            update.ChangeSegmentTimeline(this->segmentTimeline);
+    }
+
+    update.Replace(this->bitstreamSwitching, newer.bitstreamSwitching);
+
+    this->duration      = newer.duration;
+    this->startNumber   = newer.startNumber;
+}
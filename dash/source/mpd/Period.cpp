@@ -11,6 +11,8 @@
 
 #include "Period.h"
 
+#include <algorithm>
+
 using namespace dash::mpd;
 
 Period::Period  () :
@@ -22,8 +24,12 @@ Period::Period  () :
         id(""),
         start(""),
         duration(""),
-        isBitstreamSwitching(false)
+        startInMs(-1),
+        durationInMs(-1),
+        isBitstreamSwitching(false),
+        index(NULL)
 {
+    InitializeCriticalSection(&this->indexMutex);
 }
 Period::~Period ()
 {
@@ -36,6 +42,9 @@ Period::~Period ()
     delete(segmentBase);
     delete(segmentList);
     delete(segmentTemplate);
+    delete(this->index);
+
+    DeleteCriticalSection(&this->indexMutex);
 }
 
 const std::vector<IBaseUrl *>&      Period::GetBaseURLs             ()  const
@@ -77,7 +86,23 @@ const std::vector<IAdaptationSet*>& Period::GetAdaptationSets       () const
 void                                Period::AddAdaptationSet        (AdaptationSet *adaptationSet)
 {
     if(adaptationSet != NULL)
+    {
         this->adaptationSets.push_back(adaptationSet);
+        this->DropIndex();
+    }
+}
+bool                                Period::ReplaceAdaptationSet    (AdaptationSet *adaptationSet, const std::vector<AdaptationSet *>& adaptationSets)
+{
+    /* the caller owns the adaptation set from now on */
+    std::vector<AdaptationSet *>::iterator it = std::find(this->adaptationSets.begin(), this->adaptationSets.end(), adaptationSet);
+
+    if (it == this->adaptationSets.end())
+        return false;
+
+    it = this->adaptationSets.erase(it);
+    this->adaptationSets.insert(it, adaptationSets.begin(), adaptationSets.end());
+    this->DropIndex();
+    return true;
 }
 const std::vector<ISubset *>&       Period::GetSubsets              () const
 {
@@ -118,6 +143,7 @@ const std::string&                  Period::GetStart                ()  const
 void                                Period::SetStart                (const std::string& start)
 {
     this->start = start;
+    this->startInMs = dash::helpers::Time::ParseDuration(start);
 }
 const std::string&                  Period::GetDuration             ()  const
 {
@@ -126,6 +152,15 @@ const std::string&                  Period::GetDuration             ()  const
 void                                Period::SetDuration             (const std::string& duration)
 {
     this->duration = duration;
+    this->durationInMs = dash::helpers::Time::ParseDuration(duration);
+}
+int64_t                             Period::GetStartInMs            ()  const
+{
+    return this->startInMs;
+}
+int64_t                             Period::GetDurationInMs         ()  const
+{
+    return this->durationInMs;
 }
 bool                                Period::GetBitstreamSwitching   ()  const
 {
@@ -135,3 +170,41 @@ void                                Period::SetBitstreamSwitching   (bool value)
 {
     this->isBitstreamSwitching = value;
 }
+void                                Period::Merge                   (Period& newer, MPDUpdate& update)
+{
+    update.Replace(this->baseURLs, newer.baseURLs);
+    update.Merge(this->segmentBase, newer.segmentBase);
+    update.Merge(this->segmentList, newer.segmentList);
+    update.Merge(this->segmentTemplate, newer.segmentTemplate);
+    update.Merge(this->adaptationSets, newer.adaptationSets);
+    this->DropIndex();
+    update.Replace(this->subsets, newer.subsets);
+
+    this->xlinkHref             = newer.xlinkHref;
+    this->xlinkActuate          = newer.xlinkActuate;
+    this->id                    = newer.id;
+    this->start                 = newer.start;
+    this->duration              = newer.duration;
+    this->startInMs             = newer.startInMs;
+    this->durationInMs          = newer.durationInMs;
+    this->isBitstreamSwitching  = newer.isBitstreamSwitching;
+}
+const IPeriodIndex*                 Period::GetIndex                () const
+{
+    EnterCriticalSection(&this->indexMutex);
+
+    if (this->index == NULL)
+        this->index = new PeriodIndex(this->GetAdaptationSets());
+
+    LeaveCriticalSection(&this->indexMutex);
+    return this->index;
+}
+void                                Period::DropIndex               ()
+{
+    EnterCriticalSection(&this->indexMutex);
+
+    delete(this->index);
+    this->index = NULL;
+
+    LeaveCriticalSection(&this->indexMutex);
+}
@@ -22,6 +22,9 @@
 #include "SegmentList.h"
 #include "SegmentTemplate.h"
 #include "AbstractMPDElement.h"
+#include "PeriodIndex.h"
+#include "../helpers/Time.h"
+#include "../portable/MultiThreading.h"
 
 namespace dash
 {
@@ -44,13 +47,17 @@ namespace dash
                 const std::string&                      GetId                   ()  const;
                 const std::string&                      GetStart                ()  const;
                 const std::string&                      GetDuration             ()  const;
+                int64_t                                 GetStartInMs            ()  const;
+                int64_t                                 GetDurationInMs         ()  const;
                 bool                                    GetBitstreamSwitching   ()  const;
+                const IPeriodIndex*                     GetIndex                ()  const;
 
                 void    AddBaseURL                  (BaseUrl *baseURL);
                 void    SetSegmentBase              (SegmentBase *segmentBase);
                 void    SetSegmentList              (SegmentList *segmentList);
                 void    SetSegmentTemplate          (SegmentTemplate *segmentTemplate);
                 void    AddAdaptationSet            (AdaptationSet *AdaptationSet);
+                bool    ReplaceAdaptationSet        (AdaptationSet *adaptationSet, const std::vector<AdaptationSet *>& adaptationSets);
                 void    AddSubset                   (Subset *subset);
                 void    SetXlinkHref                (const std::string& xlinkHref);
                 void    SetXlinkActuate             (const std::string& xlinkActuate);
@@ -58,8 +65,11 @@ namespace dash
                 void    SetStart                    (const std::string& start);
                 void    SetDuration                 (const std::string& duration);
                 void    SetBitstreamSwitching       (bool value);
+                void    Merge                       (Period& newer, MPDUpdate& update);
 
             private:
+                void                            DropIndex               ();
+
                 std::vector<BaseUrl *>          baseURLs;
                 SegmentBase                     *segmentBase;
                 SegmentList                     *segmentList;
@@ -71,7 +81,11 @@ namespace dash
                 std::string                     id;
                 std::string                     start;
                 std::string                     duration;
+                int64_t                         startInMs;
+                int64_t                         durationInMs;
                 bool                            isBitstreamSwitching;
+                mutable PeriodIndex             *index;
+                mutable CRITICAL_SECTION        indexMutex;
         };
     }
 }
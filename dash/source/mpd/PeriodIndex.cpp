@@ -0,0 +1,176 @@
+/*
+ * PeriodIndex.cpp
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "PeriodIndex.h"
+
+#include <algorithm>
+
+using namespace dash::mpd;
+
+PeriodIndex::PeriodIndex    (const std::vector<IAdaptationSet *>& adaptationSets)
+{
+    for (size_t i = 0; i < adaptationSets.size(); i++)
+    {
+        IAdaptationSet                          *adaptationSet      = adaptationSets.at(i);
+        const std::vector<IRepresentation *>&   representations     = adaptationSet->GetRepresentation();
+        Ladder&                                 ladder              = this->ladders[adaptationSet];
+
+        if (!adaptationSet->GetLang().empty())
+            this->langs[adaptationSet->GetLang()].push_back(adaptationSet);
+
+        /* an adaptation set with the same role twice is listed once */
+        const std::vector<IDescriptor *>& roles = adaptationSet->GetRole();
+
+        for (size_t j = 0; j < roles.size(); j++)
+        {
+            std::vector<IAdaptationSet *>& listed = this->roles[roles.at(j)->GetValue()];
+
+            if (listed.empty() || listed.back() != adaptationSet)
+                listed.push_back(adaptationSet);
+        }
+
+        for (size_t j = 0; j < representations.size(); j++)
+        {
+            IRepresentation *representation = representations.at(j);
+
+            ladder.byBandwidth.push_back(representation);
+            this->representations[representation->GetId()] = representation;
+            this->adaptationSets[representation] = adaptationSet;
+
+            /* both the complete codec and its four character code lead to the representation */
+            const std::vector<std::string>& codecs = representation->GetCodecs().empty() ? adaptationSet->GetCodecs() : representation->GetCodecs();
+
+            for (size_t k = 0; k < codecs.size(); k++)
+            {
+                std::string family = codecs.at(k).substr(0, codecs.at(k).find('.'));
+
+                this->codecs[codecs.at(k)].push_back(representation);
+                if (family != codecs.at(k))
+                    this->codecs[family].push_back(representation);
+            }
+        }
+
+        /* stable, so representations of the same bandwidth stay in document order */
+        std::stable_sort(ladder.byBandwidth.begin(), ladder.byBandwidth.end(), PeriodIndex::BandwidthBelow);
+
+        ladder.byResolution = ladder.byBandwidth;
+        std::stable_sort(ladder.byResolution.begin(), ladder.byResolution.end(), PeriodIndex::ResolutionBelow);
+    }
+
+    for (std::map<std::string, std::vector<IRepresentation *> >::iterator it = this->codecs.begin(); it != this->codecs.end(); ++it)
+    {
+        std::vector<IRepresentation *>& bucket = it->second;
+
+        /* a representation listing two profiles of the same codec lands in its bucket twice */
+        bucket.erase(std::unique(bucket.begin(), bucket.end()), bucket.end());
+        std::stable_sort(bucket.begin(), bucket.end(), PeriodIndex::BandwidthBelow);
+    }
+}
+PeriodIndex::~PeriodIndex   ()
+{
+}
+
+const std::vector<IRepresentation *>&   PeriodIndex::GetBandwidthLadder             (const IAdaptationSet *adaptationSet) const
+{
+    const Ladder *ladder = this->FindLadder(adaptationSet);
+
+    return ladder ? ladder->byBandwidth : this->noRepresentations;
+}
+IRepresentation*                        PeriodIndex::GetRepresentationForBandwidth  (const IAdaptationSet *adaptationSet, uint32_t bandwidth) const
+{
+    const Ladder *ladder = this->FindLadder(adaptationSet);
+
+    if (!ladder || ladder->byBandwidth.empty())
+        return NULL;
+
+    /* the first rung above the bandwidth, the one below it is the answer */
+    std::vector<IRepresentation *>::const_iterator it = std::upper_bound(ladder->byBandwidth.begin(), ladder->byBandwidth.end(), bandwidth, PeriodIndex::BandwidthAbove);
+
+    if (it == ladder->byBandwidth.begin())
+        return ladder->byBandwidth.front();
+
+    return *(it - 1);
+}
+IRepresentation*                        PeriodIndex::GetRepresentationForResolution (const IAdaptationSet *adaptationSet, uint32_t width, uint32_t height) const
+{
+    const Ladder *ladder = this->FindLadder(adaptationSet);
+
+    if (!ladder)
+        return NULL;
+
+    /* walking down from the tallest picture that fits, the first one narrow enough is the largest */
+    std::vector<IRepresentation *>::const_iterator it = std::upper_bound(ladder->byResolution.begin(), ladder->byResolution.end(), height, PeriodIndex::HeightAbove);
+
+    while (it != ladder->byResolution.begin())
+    {
+        --it;
+
+        if ((*it)->GetWidth() <= width)
+            return *it;
+    }
+
+    return NULL;
+}
+IRepresentation*                        PeriodIndex::GetRepresentation              (const std::string &id) const
+{
+    std::map<std::string, IRepresentation *>::const_iterator it = this->representations.find(id);
+
+    return it != this->representations.end() ? it->second : NULL;
+}
+IAdaptationSet*                         PeriodIndex::GetAdaptationSet               (const IRepresentation *representation) const
+{
+    std::map<const IRepresentation *, IAdaptationSet *>::const_iterator it = this->adaptationSets.find(representation);
+
+    return it != this->adaptationSets.end() ? it->second : NULL;
+}
+const std::vector<IAdaptationSet *>&    PeriodIndex::GetAdaptationSetsByLang        (const std::string &lang) const
+{
+    std::map<std::string, std::vector<IAdaptationSet *> >::const_iterator it = this->langs.find(lang);
+
+    return it != this->langs.end() ? it->second : this->noAdaptationSets;
+}
+const std::vector<IAdaptationSet *>&    PeriodIndex::GetAdaptationSetsByRole        (const std::string &role) const
+{
+    std::map<std::string, std::vector<IAdaptationSet *> >::const_iterator it = this->roles.find(role);
+
+    return it != this->roles.end() ? it->second : this->noAdaptationSets;
+}
+const std::vector<IRepresentation *>&   PeriodIndex::GetRepresentationsByCodec      (const std::string &codec) const
+{
+    std::map<std::string, std::vector<IRepresentation *> >::const_iterator it = this->codecs.find(codec);
+
+    return it != this->codecs.end() ? it->second : this->noRepresentations;
+}
+bool                                    PeriodIndex::BandwidthBelow                 (const IRepresentation *first, const IRepresentation *second)
+{
+    return first->GetBandwidth() < second->GetBandwidth();
+}
+bool                                    PeriodIndex::BandwidthAbove                 (uint32_t bandwidth, const IRepresentation *representation)
+{
+    return bandwidth < representation->GetBandwidth();
+}
+bool                                    PeriodIndex::ResolutionBelow                (const IRepresentation *first, const IRepresentation *second)
+{
+    if (first->GetHeight() != second->GetHeight())
+        return first->GetHeight() < second->GetHeight();
+
+    return first->GetWidth() < second->GetWidth();
+}
+bool                                    PeriodIndex::HeightAbove                    (uint32_t height, const IRepresentation *representation)
+{
+    return height < representation->GetHeight();
+}
+const PeriodIndex::Ladder*              PeriodIndex::FindLadder                     (const IAdaptationSet *adaptationSet) const
+{
+    std::map<const IAdaptationSet *, Ladder>::const_iterator it = this->ladders.find(adaptationSet);
+
+    return it != this->ladders.end() ? &it->second : NULL;
+}
@@ -0,0 +1,64 @@
+/*
+ * PeriodIndex.h
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PERIODINDEX_H_
+#define PERIODINDEX_H_
+
+#include "config.h"
+
+#include "IPeriodIndex.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /* everything is sorted or keyed once when built, the period drops it whenever its adaptation sets change */
+        class PeriodIndex : public IPeriodIndex
+        {
+            public:
+                PeriodIndex             (const std::vector<IAdaptationSet *>& adaptationSets);
+                virtual ~PeriodIndex    ();
+
+                const std::vector<IRepresentation *>&   GetBandwidthLadder              (const IAdaptationSet *adaptationSet) const;
+                IRepresentation*                        GetRepresentationForBandwidth   (const IAdaptationSet *adaptationSet, uint32_t bandwidth) const;
+                IRepresentation*                        GetRepresentationForResolution  (const IAdaptationSet *adaptationSet, uint32_t width, uint32_t height) const;
+                IRepresentation*                        GetRepresentation               (const std::string &id) const;
+                IAdaptationSet*                         GetAdaptationSet                (const IRepresentation *representation) const;
+                const std::vector<IAdaptationSet *>&    GetAdaptationSetsByLang         (const std::string &lang) const;
+                const std::vector<IAdaptationSet *>&    GetAdaptationSetsByRole         (const std::string &role) const;
+                const std::vector<IRepresentation *>&   GetRepresentationsByCodec       (const std::string &codec) const;
+
+            private:
+                struct Ladder
+                {
+                    std::vector<IRepresentation *>  byBandwidth;
+                    std::vector<IRepresentation *>  byResolution;
+                };
+
+                static bool BandwidthBelow  (const IRepresentation *first, const IRepresentation *second);
+                static bool BandwidthAbove  (uint32_t bandwidth, const IRepresentation *representation);
+                static bool ResolutionBelow (const IRepresentation *first, const IRepresentation *second);
+                static bool HeightAbove     (uint32_t height, const IRepresentation *representation);
+                const Ladder*               FindLadder  (const IAdaptationSet *adaptationSet) const;
+
+                std::map<const IAdaptationSet *, Ladder>                    ladders;
+                std::map<std::string, IRepresentation *>                    representations;
+                std::map<const IRepresentation *, IAdaptationSet *>         adaptationSets;
+                std::map<std::string, std::vector<IAdaptationSet *> >       langs;
+                std::map<std::string, std::vector<IAdaptationSet *> >       roles;
+                std::map<std::string, std::vector<IRepresentation *> >      codecs;
+                std::vector<IAdaptationSet *>                               noAdaptationSets;
+                std::vector<IRepresentation *>                              noRepresentations;
+        };
+    }
+}
+
+#endif /* PERIODINDEX_H_ */
@@ -114,3 +114,19 @@ void                                        Representation::SetMediaStreamStruct
 {
     dash::helpers::String::Split(mediaStreamStructureId, ' ', this->mediaStreamStructureId);
 }
+void                                        Representation::Merge                       (Representation& newer, MPDUpdate& update)
+{
+    RepresentationBase::Merge(newer, update);
+
+    update.Replace(this->baseURLs, newer.baseURLs);
+    update.Replace(this->subRepresentations, newer.subRepresentations);
+    update.Merge(this->segmentBase, newer.segmentBase);
+    update.Merge(this->segmentList, newer.segmentList);
+    update.Merge(this->segmentTemplate, newer.segmentTemplate);
+
+    this->id                        = newer.id;
+    this->bandwidth                 = newer.bandwidth;
+    this->qualityRanking            = newer.qualityRanking;
+    this->dependencyId              = newer.dependencyId;
+    this->mediaStreamStructureId    = newer.mediaStreamStructureId;
+}
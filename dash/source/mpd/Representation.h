@@ -54,6 +54,7 @@ namespace dash
                 void    SetQualityRanking           (uint32_t qualityRanking);
                 void    SetDependencyId             (const std::string &dependencyId);
                 void    SetMediaStreamStructureId   (const std::string &mediaStreamStructureId);
+                void    Merge                       (Representation& newer, MPDUpdate& update);
 
             private:
                 std::vector<BaseUrl *>              baseURLs;
@@ -10,6 +10,7 @@
  *****************************************************************************/
 
 #include "RepresentationBase.h"
+#include <stdlib.h>
 
 using namespace dash::mpd;
 
@@ -18,6 +19,8 @@ RepresentationBase::RepresentationBase  () :
                     height(0),
                     sar(""),
                     frameRate(""),
+                    frameRateNumerator(0),
+                    frameRateDenominator(1),
                     audioSamplingRate(""),
                     mimeType(""),
                     maximumSAPPeriod(0.0),
@@ -85,7 +88,7 @@ void                                RepresentationBase::SetHeight
 {
     this->height = height;
 }
-std::string                         RepresentationBase::GetSar                          () const
+const std::string&                  RepresentationBase::GetSar                          () const
 {
     return this->sar;
 }
@@ -93,15 +96,42 @@ void                                RepresentationBase::SetSar
 {
     this->sar = sar;
 }
-std::string                         RepresentationBase::GetFrameRate                    () const
+const std::string&                  RepresentationBase::GetFrameRate                    () const
 {
     return this->frameRate;
 }
 void                                RepresentationBase::SetFrameRate                    (const std::string& frameRate)
 {
     this->frameRate = frameRate;
+
+    /* F or F/D */
+    char *end = NULL;
+    this->frameRateNumerator    = strtoul(frameRate.c_str(), &end, 10);
+    this->frameRateDenominator  = 1;
+
+    if (end == frameRate.c_str())
+    {
+        this->frameRateNumerator = 0;
+    }
+    else if (*end == '/')
+    {
+        this->frameRateDenominator = strtoul(end + 1, NULL, 10);
+        if (this->frameRateDenominator == 0)
+        {
+            this->frameRateNumerator    = 0;
+            this->frameRateDenominator  = 1;
+        }
+    }
 }
-std::string                         RepresentationBase::GetAudioSamplingRate            () const
+uint32_t                            RepresentationBase::GetFrameRateNumerator           () const
+{
+    return this->frameRateNumerator;
+}
+uint32_t                            RepresentationBase::GetFrameRateDenominator         () const
+{
+    return this->frameRateDenominator;
+}
+const std::string&                  RepresentationBase::GetAudioSamplingRate            () const
 {
     return this->audioSamplingRate;
 }
@@ -109,7 +139,7 @@ void                                RepresentationBase::SetAudioSamplingRate
 {
     this->audioSamplingRate = audioSamplingRate;
 }
-std::string                         RepresentationBase::GetMimeType                     () const
+const std::string&                  RepresentationBase::GetMimeType                     () const
 {
     return this->mimeType;
 }
@@ -165,7 +195,7 @@ void                                RepresentationBase::SetCodingDependency
 {
     this->codingDependency = codingDependency;
 }
-std::string                         RepresentationBase::GetScanType                     () const
+const std::string&                  RepresentationBase::GetScanType                     () const
 {
     return this->scanType;
 }
@@ -173,3 +203,26 @@ void                                RepresentationBase::SetScanType
 {
     this->scanType = scanType;
 }
+void                                RepresentationBase::Merge                           (RepresentationBase& newer, MPDUpdate& update)
+{
+    update.Replace(this->framePacking, newer.framePacking);
+    update.Replace(this->audioChannelConfiguration, newer.audioChannelConfiguration);
+    update.Replace(this->contentProtection, newer.contentProtection);
+
+    this->profiles              = newer.profiles;
+    this->width                 = newer.width;
+    this->height                = newer.height;
+    this->sar                   = newer.sar;
+    this->frameRate             = newer.frameRate;
+    this->frameRateNumerator    = newer.frameRateNumerator;
+    this->frameRateDenominator  = newer.frameRateDenominator;
+    this->audioSamplingRate     = newer.audioSamplingRate;
+    this->mimeType              = newer.mimeType;
+    this->segmentProfiles       = newer.segmentProfiles;
+    this->codecs                = newer.codecs;
+    this->maximumSAPPeriod      = newer.maximumSAPPeriod;
+    this->startWithSAP          = newer.startWithSAP;
+    this->maxPlayoutRate        = newer.maxPlayoutRate;
+    this->codingDependency      = newer.codingDependency;
+    this->scanType              = newer.scanType;
+}
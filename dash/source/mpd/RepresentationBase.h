@@ -18,6 +18,7 @@
 #include "Descriptor.h"
 #include "../helpers/String.h"
 #include "AbstractMPDElement.h"
+#include "MPDUpdate.h"
 
 namespace dash
 {
@@ -35,17 +36,19 @@ namespace dash
                 const std::vector<std::string>&     GetProfiles                     () const;
                 uint32_t                            GetWidth                        () const;
                 uint32_t                            GetHeight                       () const;
-                std::string                         GetSar                          () const;
-                std::string                         GetFrameRate                    () const;
-                std::string                         GetAudioSamplingRate            () const;
-                std::string                         GetMimeType                     () const;
+                const std::string&                  GetSar                          () const;
+                const std::string&                  GetFrameRate                    () const;
+                uint32_t                            GetFrameRateNumerator           () const;
+                uint32_t                            GetFrameRateDenominator         () const;
+                const std::string&                  GetAudioSamplingRate            () const;
+                const std::string&                  GetMimeType                     () const;
                 const std::vector<std::string>&     GetSegmentProfiles              () const;
                 const std::vector<std::string>&     GetCodecs                       () const;
                 double                              GetMaximumSAPPeriod             () const;
                 uint8_t                             GetStartWithSAP                 () const;
                 double                              GetMaxPlayoutRate               () const;
                 bool                                HasCodingDependency             () const;
-                std::string                         GetScanType                     () const;
+                const std::string&                  GetScanType                     () const;
 
                 void    AddFramePacking                 (Descriptor *framePacking);
                 void    AddAudioChannelConfiguration    (Descriptor *audioChannelConfiguration);
@@ -64,6 +67,7 @@ namespace dash
                 void    SetMaxPlayoutRate               (double maxPlayoutRate);
                 void    SetCodingDependency             (bool codingDependency);
                 void    SetScanType                     (const std::string& scanType);
+                void    Merge                           (RepresentationBase& newer, MPDUpdate& update);
 
             protected:
                 std::vector<Descriptor *>   framePacking;
@@ -74,6 +78,8 @@ namespace dash
                 uint32_t                    height;
                 std::string                 sar;
                 std::string                 frameRate;
+                uint32_t                    frameRateNumerator;
+                uint32_t                    frameRateDenominator;
                 std::string                 audioSamplingRate;
                 std::string                 mimeType;
                 std::vector<std::string>    segmentProfiles;
@@ -10,6 +10,7 @@
  *****************************************************************************/
 
 #include "Segment.h"
+#include "BaseUrl.h"
 
 using namespace dash::mpd;
 using namespace dash::helpers;
@@ -30,24 +31,39 @@ Segment::~Segment   ()
 
 bool                Segment::Init               (const std::vector<IBaseUrl *>& baseurls, const std::string &uri, const std::string &range, HTTPTransactionType type)
 {
-    std::string host        = "";
-    size_t      port        = 80;
-    std::string path        = "";
+    return this->Init(Segment::ResolveBaseUrls(baseurls), uri, range, type);
+}
+dash::helpers::Url  Segment::ResolveBaseUrls    (const std::vector<IBaseUrl *>& baseurls)
+{
+    /* the base urls of the library were split when they were read, others are split here */
+    dash::helpers::Url base;
+
+    for (size_t i = 0; i < baseurls.size(); i++)
+    {
+        const BaseUrl *baseUrl = dynamic_cast<const BaseUrl *>(baseurls.at(i));
+
+        if (baseUrl != NULL)
+            base = base.Resolve(baseUrl->GetReference());
+        else
+            base = base.Resolve(baseurls.at(i)->GetUrl());
+    }
+
+    return base;
+}
+bool                Segment::Init               (const dash::helpers::Url& base, const std::string &uri, const std::string &range, HTTPTransactionType type)
+{
     size_t      startByte   = 0;
     size_t      endByte     = 0;
 
-    this->absoluteuri = "";
-
-    for(size_t i = 0; i < baseurls.size(); i++)
-        this->absoluteuri = Path::CombinePaths(this->absoluteuri, baseurls.at(i)->GetUrl());
+    dash::helpers::Url target = base.Resolve(uri);
 
-    this->absoluteuri = Path::CombinePaths(this->absoluteuri, uri);
+    this->absoluteuri = target.ToString();
 
-    if (uri != "" && dash::helpers::Path::GetHostPortAndPath(this->absoluteuri, host, port, path))
+    if (uri != "" && target.IsHttp())
     {
-        this->host = host;
-        this->port = port;
-        this->path = path;
+        this->host = target.GetHost();
+        this->port = target.GetPort();
+        this->path = target.GetPathAndQuery();
 
         if (range != "" && dash::helpers::Path::GetStartAndEndBytes(range, startByte, endByte))
         {
@@ -136,3 +152,47 @@ void                Segment::SetType            (HTTPTransactionType type)
 {
     this->type = type;
 }
+
+BaseUrlCache::BaseUrlCache  () :
+                isResolved(false)
+{
+    InitializeCriticalSection(&this->lock);
+}
+BaseUrlCache::~BaseUrlCache ()
+{
+    DeleteCriticalSection(&this->lock);
+}
+
+const dash::helpers::Url&   BaseUrlCache::Acquire   (const std::vector<IBaseUrl *>& baseurls)
+{
+    EnterCriticalSection(&this->lock);
+
+    if (!this->Matches(baseurls))
+    {
+        this->base          = Segment::ResolveBaseUrls(baseurls);
+        this->baseurls      = baseurls;
+        this->isResolved    = true;
+
+        this->urls.clear();
+        for (size_t i = 0; i < baseurls.size(); i++)
+            this->urls.push_back(baseurls.at(i)->GetUrl());
+    }
+
+    return this->base;
+}
+void                        BaseUrlCache::Release   ()
+{
+    LeaveCriticalSection(&this->lock);
+}
+bool                        BaseUrlCache::Matches   (const std::vector<IBaseUrl *>& baseurls) const
+{
+    /* the urls are compared as well, an update may change a base url in place or reuse the address of a removed one */
+    if (baseurls.size() != this->baseurls.size() || !this->isResolved)
+        return false;
+
+    for (size_t i = 0; i < baseurls.size(); i++)
+        if (baseurls.at(i) != this->baseurls.at(i) || baseurls.at(i)->GetUrl() != this->urls.at(i))
+            return false;
+
+    return true;
+}
@@ -16,9 +16,11 @@
 
 #include "../network/AbstractChunk.h"
 #include "../helpers/Path.h"
+#include "../helpers/Url.h"
 #include "ISegment.h"
 #include "IBaseUrl.h"
 #include "../metrics/HTTPTransaction.h"
+#include "../portable/MultiThreading.h"
 
 namespace dash
 {
@@ -32,6 +34,8 @@ namespace dash
 
                 bool                                Init            (const std::vector<IBaseUrl *>& baseurls, const std::string &uri,
                                                                      const std::string &range, dash::metrics::HTTPTransactionType type);
+                bool                                Init            (const helpers::Url& base, const std::string &uri,
+                                                                     const std::string &range, dash::metrics::HTTPTransactionType type);
                 std::string&                        AbsoluteURI     ();
                 std::string&                        Host            ();
                 size_t                              Port            ();
@@ -52,6 +56,9 @@ namespace dash
                 void            HasByteRange (bool hasByteRange);
                 void            SetType      (dash::metrics::HTTPTransactionType type);
 
+                /* resolves a chain of base urls once, for callers creating many segments against the same chain */
+                static helpers::Url                 ResolveBaseUrls (const std::vector<IBaseUrl *>& baseurls);
+
             private:
                 std::string                         absoluteuri;
                 std::string                         host;
@@ -63,6 +70,30 @@ namespace dash
                 bool                                hasByteRange;
                 dash::metrics::HTTPTransactionType  type;
         };
+
+        /* the chain of base urls an element creates its segments against, resolved again only when the chain changed */
+        class BaseUrlCache
+        {
+            public:
+                BaseUrlCache            ();
+                virtual ~BaseUrlCache   ();
+
+                /* locks the cache, the url returned stays valid until Release() */
+                const helpers::Url&     Acquire (const std::vector<IBaseUrl *>& baseurls);
+                void                    Release ();
+
+            private:
+                BaseUrlCache            (const BaseUrlCache& other);
+                BaseUrlCache& operator= (const BaseUrlCache& other);
+
+                bool                    Matches (const std::vector<IBaseUrl *>& baseurls) const;
+
+                CRITICAL_SECTION            lock;
+                std::vector<IBaseUrl *>     baseurls;
+                std::vector<std::string>    urls;
+                helpers::Url                base;
+                bool                        isResolved;
+        };
     }
 }
 
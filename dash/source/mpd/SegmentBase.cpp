@@ -52,11 +52,11 @@ void                SegmentBase::SetTimescale               (uint32_t timescale)
 {
     this->timescale = timescale;
 }
-uint32_t            SegmentBase::GetPresentationTimeOffset  ()  const
+uint64_t            SegmentBase::GetPresentationTimeOffset  ()  const
 {
     return this->presentationTimeOffset;
 }
-void                SegmentBase::SetPresentationTimeOffset  (uint32_t presentationTimeOffset)
+void                SegmentBase::SetPresentationTimeOffset  (uint64_t presentationTimeOffset)
 {
     this->presentationTimeOffset = presentationTimeOffset;
 }
@@ -76,3 +76,13 @@ void                SegmentBase::SetIndexRangeExact         (bool indexRangeExac
 {
     this->indexRangeExact = indexRangeExact;
 }
+void                SegmentBase::Merge                      (SegmentBase& newer, MPDUpdate& update)
+{
+    update.Replace(this->initialization, newer.initialization);
+    update.Replace(this->representationIndex, newer.representationIndex);
+
+    this->timescale                 = newer.timescale;
+    this->presentationTimeOffset    = newer.presentationTimeOffset;
+    this->indexRange                = newer.indexRange;
+    this->indexRangeExact           = newer.indexRangeExact;
+}
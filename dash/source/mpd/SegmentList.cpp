@@ -30,6 +30,7 @@ const std::vector<ISegmentURL*>& SegmentList::GetSegmentURLs    ()  const
 }
 void                            SegmentList::AddSegmentURL      (SegmentURL *segmentURL)
 {
+    segmentURL->SetBaseUrlCache(&this->baseUrlCache);
     this->segmentURLs.push_back(segmentURL);
 }
 const std::string&              SegmentList::GetXlinkHref       ()  const
@@ -48,3 +49,19 @@ void                            SegmentList::SetXlinkActuate    (const std::stri
 {
     this->xlinkActuate = xlinkActuate;
 }
+void                            SegmentList::Merge              (SegmentList& newer, MPDUpdate& update)
+{
+    MultipleSegmentBase::Merge(newer, update);
+
+    /* the retired urls may outlive the list in the update */
+    for (size_t i = 0; i < this->segmentURLs.size(); i++)
+        this->segmentURLs.at(i)->SetBaseUrlCache(NULL);
+
+    update.Replace(this->segmentURLs, newer.segmentURLs);
+
+    for (size_t i = 0; i < this->segmentURLs.size(); i++)
+        this->segmentURLs.at(i)->SetBaseUrlCache(&this->baseUrlCache);
+
+    this->xlinkHref     = newer.xlinkHref;
+    this->xlinkActuate  = newer.xlinkActuate;
+}
@@ -35,11 +35,14 @@ namespace dash
                 void    AddSegmentURL   (SegmentURL *segmetURL);
                 void    SetXlinkHref    (const std::string& xlinkHref);
                 void    SetXlinkActuate (const std::string& xlinkActuate);
+                void    Merge           (SegmentList& newer, MPDUpdate& update);
 
             private:
                 std::vector<SegmentURL *> segmentURLs;
                 std::string xlinkHref;
                 std::string xlinkActuate;
+
+                BaseUrlCache    baseUrlCache;
         };
     }
 }
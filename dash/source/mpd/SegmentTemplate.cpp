@@ -32,6 +32,7 @@ const std::string&  SegmentTemplate::Getmedia                       ()  const
 void                SegmentTemplate::SetMedia                       (const std::string& media)
 {
     this->media = media;
+    SegmentTemplate::Compile(media, this->mediaProgram);
 }
 const std::string&  SegmentTemplate::Getindex                       ()  const
 {
@@ -40,6 +41,7 @@ const std::string&  SegmentTemplate::Getindex                       ()  const
 void                SegmentTemplate::SetIndex                       (const std::string& index)
 {
     this->index = index;
+    SegmentTemplate::Compile(index, this->indexProgram);
 }
 const std::string&  SegmentTemplate::Getinitialization              ()  const
 {
@@ -48,6 +50,7 @@ const std::string&  SegmentTemplate::Getinitialization              ()  const
 void                SegmentTemplate::SetInitialization              (const std::string& initialization)
 {
     this->initialization = initialization;
+    SegmentTemplate::Compile(initialization, this->initializationProgram);
 }
 const std::string&  SegmentTemplate::GetbitstreamSwitching          ()  const
 {
@@ -56,97 +59,174 @@ const std::string&  SegmentTemplate::GetbitstreamSwitching          ()  const
 void                SegmentTemplate::SetBitstreamSwitching          (const std::string& bitstreamSwitching)
 {
     this->bitstreamSwitching = bitstreamSwitching;
+    SegmentTemplate::Compile(bitstreamSwitching, this->bitstreamSwitchingProgram);
+}
+void                SegmentTemplate::Merge                          (SegmentTemplate& newer, MPDUpdate& update)
+{
+    MultipleSegmentBase::Merge(newer, update);
+
+    /* only recompile templates that changed */
+    if (this->media != newer.media)
+        this->SetMedia(newer.media);
+    if (this->index != newer.index)
+        this->SetIndex(newer.index);
+    if (this->initialization != newer.initialization)
+        this->SetInitialization(newer.initialization);
+    if (this->bitstreamSwitching != newer.bitstreamSwitching)
+        this->SetBitstreamSwitching(newer.bitstreamSwitching);
 }
 ISegment*           SegmentTemplate::ToInitializationSegment        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const
 {
-    return ToSegment(this->initialization, baseurls, representationID, bandwidth, dash::metrics::InitializationSegment);
+    return ToSegment(this->initializationProgram, baseurls, representationID, bandwidth, dash::metrics::InitializationSegment);
 }
 ISegment*           SegmentTemplate::ToBitstreamSwitchingSegment    (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const
 {
-    return ToSegment(this->bitstreamSwitching, baseurls, representationID, bandwidth, dash::metrics::BitstreamSwitchingSegment);
+    return ToSegment(this->bitstreamSwitchingProgram, baseurls, representationID, bandwidth, dash::metrics::BitstreamSwitchingSegment);
 }
-ISegment*           SegmentTemplate::GetMediaSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const
+ISegment*           SegmentTemplate::GetMediaSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t number) const
 {
-    return ToSegment(this->media, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, number);
+    return ToSegment(this->mediaProgram, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, number);
 }
-ISegment*           SegmentTemplate::GetIndexSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const
+ISegment*           SegmentTemplate::GetIndexSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t number) const
 {
-    return ToSegment(this->index, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, number);
+    return ToSegment(this->indexProgram, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, number);
 }
-ISegment*           SegmentTemplate::GetMediaSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const
+ISegment*           SegmentTemplate::GetMediaSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const
 {
-    return ToSegment(this->media, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, 0, time);
+    return ToSegment(this->mediaProgram, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, 0, time);
 }
-ISegment*           SegmentTemplate::GetIndexSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const
+ISegment*           SegmentTemplate::GetIndexSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const
 {
-    return ToSegment(this->index, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, 0, time);
+    return ToSegment(this->indexProgram, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, 0, time);
 }
-std::string         SegmentTemplate::ReplaceParameters              (const std::string& uri, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint32_t time) const
+void                SegmentTemplate::Compile                        (const std::string& uri, Program& program)
 {
-    std::vector<std::string> chunks;
-    std::string replacedUri = "";
+    program.clear();
 
-    dash::helpers::String::Split(uri, '$', chunks);
+    Token literal;
+    literal.type    = Literal;
+    literal.width   = 0;
 
-    if (chunks.size() > 1) 
+    size_t pos = 0;
+    while (pos < uri.size())
     {
-        for(size_t i = 0; i < chunks.size(); i++) 
+        size_t open = uri.find('$', pos);
+        size_t close = open == std::string::npos ? std::string::npos : uri.find('$', open + 1);
+
+        /* an unterminated identifier is taken literally */
+        if (close == std::string::npos)
+        {
+            literal.literal.append(uri, pos, std::string::npos);
+            break;
+        }
+
+        literal.literal.append(uri, pos, open - pos);
+        pos = close + 1;
+
+        /* $$ is an escaped dollar sign */
+        if (close == open + 1)
+        {
+            literal.literal += '$';
+            continue;
+        }
+
+        std::string identifier  = uri.substr(open + 1, close - open - 1);
+        std::string format      = "";
+        size_t      percent     = identifier.find('%');
+
+        if (percent != std::string::npos)
+        {
+            format = identifier.substr(percent);
+            identifier.erase(percent);
+        }
+
+        Token token;
+        token.width = 1;
+
+        if (identifier == "RepresentationID" && format.empty())
+            token.type = RepresentationID;
+        else if (identifier == "Number")
+            token.type = Number;
+        else if (identifier == "Bandwidth")
+            token.type = Bandwidth;
+        else if (identifier == "Time")
+            token.type = Time;
+        else
         {
-            if ( chunks.at(i) == "RepresentationID") {
-                chunks.at(i) = representationID;
-                continue;
-            }
-
-            if (chunks.at(i).find("Bandwidth") == 0)
-            {
-                FormatChunk(chunks.at(i), bandwidth);
-                continue;
-            }
-
-            if (chunks.at(i).find("Number") == 0)
-            {
-                FormatChunk(chunks.at(i), number);
-                continue;
-            }
-
-            if (chunks.at(i).find("Time") == 0)
-            {
-                FormatChunk(chunks.at(i), time);
-                continue;
-            }
+            /* unknown identifiers are left in the url as they are */
+            literal.literal.append(uri, open, close - open + 1);
+            continue;
         }
 
-        for(size_t i = 0; i < chunks.size(); i++) 
-            replacedUri += chunks.at(i);
+        /* the format tag is %0[width]d, only the width matters */
+        if (format.size() > 2 && format.compare(0, 2, "%0") == 0)
+            token.width = atoi(format.c_str() + 2);
 
-        return replacedUri;
+        if (token.width < 1)
+            token.width = 1;
+        if (token.width > 40)
+            token.width = 40;
+
+        if (!literal.literal.empty())
+        {
+            program.push_back(literal);
+            literal.literal.clear();
+        }
+        program.push_back(token);
     }
-    else
+
+    if (!literal.literal.empty())
+        program.push_back(literal);
+}
+void                SegmentTemplate::Render                         (const Program& program, std::string& uri, const std::string& representationID, uint32_t bandwidth, uint64_t number, uint64_t time)
+{
+    for (size_t i = 0; i < program.size(); i++)
     {
-        replacedUri = uri;
-        return replacedUri;
+        const Token& token = program.at(i);
+
+        switch (token.type)
+        {
+            case Literal:           uri += token.literal;                       break;
+            case RepresentationID:  uri += representationID;                    break;
+            case Number:            AppendNumber(uri, number, token.width);     break;
+            case Bandwidth:         AppendNumber(uri, bandwidth, token.width);  break;
+            case Time:              AppendNumber(uri, time, token.width);       break;
+        }
     }
 }
-void                SegmentTemplate::FormatChunk                    (std::string& uri, uint32_t number) const
+void                SegmentTemplate::AppendNumber                   (std::string& uri, uint64_t number, int width)
 {
-    char formattedNumber [50];
-    size_t pos = 0;
-    std::string formatTag = "%01d";
+    char    digits[20];
+    int     count = 0;
+
+    do
+    {
+        digits[count++] = (char) ('0' + number % 10);
+        number /= 10;
+    } while (number);
 
-    if ( (pos = uri.find("%0")) != std::string::npos)
-        formatTag = uri.substr(pos).append("d");
+    if (width > count)
+        uri.append(width - count, '0');
 
-    sprintf(formattedNumber, formatTag.c_str(), number);
-    uri = formattedNumber;
+    while (count)
+        uri += digits[--count];
 }
-ISegment*           SegmentTemplate::ToSegment                      (const std::string& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, HTTPTransactionType type, uint32_t number, uint32_t time) const
+ISegment*           SegmentTemplate::ToSegment                      (const Program& program, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, HTTPTransactionType type, uint64_t number, uint64_t time) const
 {
-    Segment *seg = new Segment();
+    Segment                     *seg    = new Segment();
+    const dash::helpers::Url&   base    = this->baseUrlCache.Acquire(baseurls);
 
-    if(seg->Init(baseurls, ReplaceParameters(uri, representationID, bandwidth, number, time), "", type))
+    this->uri.clear();
+    Render(program, this->uri, representationID, bandwidth, number, time);
+
+    bool isInitialized = seg->Init(base, this->uri, "", type);
+
+    this->baseUrlCache.Release();
+
+    if(isInitialized)
         return seg;
 
     delete(seg);
 
     return NULL;
-}
\ No newline at end of file
+}
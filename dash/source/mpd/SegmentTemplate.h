@@ -34,26 +34,55 @@ namespace dash
                 const std::string&  GetbitstreamSwitching   ()  const;
                 ISegment*           ToInitializationSegment     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const;
                 ISegment*           ToBitstreamSwitchingSegment (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const;
-                ISegment*           GetMediaSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const;
-                ISegment*           GetIndexSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const;
-                ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const;
-                ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const;
+                ISegment*           GetMediaSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t number) const;
+                ISegment*           GetIndexSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t number) const;
+                ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const;
+                ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const;
 
                 void    SetMedia                (const std::string& media);
                 void    SetIndex                (const std::string& index);
                 void    SetInitialization       (const std::string& initialization);
                 void    SetBitstreamSwitching   (const std::string& bitstreamSwichting);
+                void    Merge                   (SegmentTemplate& newer, MPDUpdate& update);
 
             private:
-                std::string ReplaceParameters   (const std::string& uri, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint32_t time) const;
-                void        FormatChunk         (std::string& uri, uint32_t number) const;
-                ISegment*   ToSegment           (const std::string& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, 
-                                                 dash::metrics::HTTPTransactionType type, uint32_t number = 0, uint32_t time = 0) const;
+                enum TokenType
+                {
+                    Literal,
+                    RepresentationID,
+                    Number,
+                    Bandwidth,
+                    Time
+                };
+
+                /* a template compiled into literals and substitutions, so rendering a url doesn't reparse it */
+                struct Token
+                {
+                    TokenType   type;
+                    std::string literal;
+                    int         width;
+                };
+                typedef std::vector<Token> Program;
+
+                static void Compile             (const std::string& uri, Program& program);
+                static void Render              (const Program& program, std::string& uri, const std::string& representationID, uint32_t bandwidth, uint64_t number, uint64_t time);
+                static void AppendNumber        (std::string& uri, uint64_t number, int width);
+                ISegment*   ToSegment           (const Program& program, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, 
+                                                 dash::metrics::HTTPTransactionType type, uint64_t number = 0, uint64_t time = 0) const;
 
                 std::string media;
                 std::string index;
                 std::string initialization;
                 std::string bitstreamSwitching;
+
+                Program     mediaProgram;
+                Program     indexProgram;
+                Program     initializationProgram;
+                Program     bitstreamSwitchingProgram;
+
+                /* the base all segments are resolved against and the buffer their urls are rendered into, both guarded by the cache */
+                mutable BaseUrlCache    baseUrlCache;
+                mutable std::string     uri;
         };
     }
 }
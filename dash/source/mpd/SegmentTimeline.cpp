@@ -11,22 +11,240 @@
 
 #include "SegmentTimeline.h"
 
+#include <algorithm>
+
 using namespace dash::mpd;
 
-SegmentTimeline::SegmentTimeline    ()
+SegmentTimeline::SegmentTimeline    ()  :
+                    isIndexed(false)
 {
+    InitializeCriticalSection(&this->indexMutex);
 }
 SegmentTimeline::~SegmentTimeline   ()
 {
     for (size_t i=0; i < this->timelines.size(); i++)
         delete(this->timelines.at(i));
+
+    DeleteCriticalSection(&this->indexMutex);
 }
 
-std::vector<ITimeline *>&   SegmentTimeline::GetTimelines   ()  const
+std::vector<ITimeline *>&   SegmentTimeline::GetTimelines       ()  const
 {
     return (std::vector<ITimeline*> &) this->timelines;
 }
-void                        SegmentTimeline::AddTimeline    (Timeline *timeline)
+uint64_t                    SegmentTimeline::GetSegmentCount    ()  const
+{
+    EnterCriticalSection(&this->indexMutex);
+
+    this->BuildIndex();
+
+    uint64_t count = 0;
+    if (!this->index.empty())
+        count = this->index.back().firstIndex + this->index.back().count;
+
+    LeaveCriticalSection(&this->indexMutex);
+    return count;
+}
+bool                        SegmentTimeline::FindSegmentByTime  (uint64_t time, uint64_t& index, uint64_t& startTime, uint64_t& duration) const
+{
+    EnterCriticalSection(&this->indexMutex);
+
+    this->BuildIndex();
+
+    bool found = false;
+
+    /* last entry starting at or before the time, if the time precedes all of them the first entry's first segment follows it */
+    std::vector<IndexEntry>::const_iterator it = std::upper_bound(this->index.begin(), this->index.end(), time, SegmentTimeline::StartsAfter);
+    uint64_t offset = 0;
+
+    if (it != this->index.begin())
+    {
+        --it;
+        offset = (time - it->startTime) / it->duration;
+
+        /* the time lies in a gap behind this entry */
+        if (offset >= it->count)
+        {
+            ++it;
+            offset = 0;
+        }
+    }
+
+    if (it != this->index.end())
+    {
+        index       = it->firstIndex + offset;
+        startTime   = it->startTime + offset * it->duration;
+        duration    = it->duration;
+        found       = true;
+    }
+
+    LeaveCriticalSection(&this->indexMutex);
+    return found;
+}
+bool                        SegmentTimeline::FindSegmentByIndex (uint64_t index, uint64_t& startTime, uint64_t& duration) const
 {
+    EnterCriticalSection(&this->indexMutex);
+
+    this->BuildIndex();
+
+    bool found = false;
+
+    std::vector<IndexEntry>::const_iterator it = std::upper_bound(this->index.begin(), this->index.end(), index, SegmentTimeline::FirstIndexAfter);
+
+    if (it != this->index.begin())
+    {
+        --it;
+        uint64_t offset = index - it->firstIndex;
+
+        if (offset < it->count)
+        {
+            startTime   = it->startTime + offset * it->duration;
+            duration    = it->duration;
+            found       = true;
+        }
+    }
+
+    LeaveCriticalSection(&this->indexMutex);
+    return found;
+}
+void                        SegmentTimeline::AddTimeline        (Timeline *timeline)
+{
+    EnterCriticalSection(&this->indexMutex);
+
     this->timelines.push_back(timeline);
-}
\ No newline at end of file
+    this->isIndexed = false;
+
+    LeaveCriticalSection(&this->indexMutex);
+}
+bool                        SegmentTimeline::Merge              (SegmentTimeline& newer, MPDUpdate& update)
+{
+    EnterCriticalSection(&this->indexMutex);
+    EnterCriticalSection(&newer.indexMutex);
+
+    this->BuildIndex();
+    newer.BuildIndex();
+
+    /* the revision's S elements are taken over, those describing segments that were known already keep their object */
+    std::vector<ITimeline *>    merged;
+    std::vector<bool>           isKept(this->timelines.size(), false);
+    bool                        isChanged   = false;
+    size_t                      current     = 0;
+
+    merged.reserve(newer.timelines.size());
+
+    for (size_t i = 0; i < newer.index.size(); i++)
+    {
+        const IndexEntry& entry = newer.index.at(i);
+
+        /* entries that ended before this one starts have slid out of the window */
+        while (current < this->index.size() && SegmentTimeline::EndOf(this->index.at(current)) <= entry.startTime)
+            current++;
+
+        if (current < this->index.size() && this->index.at(current).duration == entry.duration &&
+            entry.startTime >= this->index.at(current).startTime && (entry.startTime - this->index.at(current).startTime) % entry.duration == 0)
+        {
+            const IndexEntry&   old         = this->index.at(current);
+            Timeline            *timeline   = (Timeline *) this->timelines.at(old.position);
+            ITimeline           *revision   = newer.timelines.at(entry.position);
+
+            if (old.startTime != entry.startTime || timeline->GetRepeatCount() != revision->GetRepeatCount())
+                isChanged = true;
+
+            timeline->SetStartTime(revision->GetStartTime());
+            timeline->SetRepeatCount(revision->GetRepeatCount());
+
+            isKept.at(old.position) = true;
+            merged.push_back(timeline);
+            current++;
+        }
+        else
+        {
+            merged.push_back(newer.timelines.at(entry.position));
+            newer.timelines.at(entry.position) = NULL;
+            isChanged = true;
+        }
+    }
+
+    for (size_t i = 0; i < this->timelines.size(); i++)
+    {
+        if (!isKept.at(i))
+        {
+            update.Retire(this->timelines.at(i));
+            isChanged = true;
+        }
+    }
+
+    this->timelines.swap(merged);
+    this->isIndexed = false;
+
+    LeaveCriticalSection(&newer.indexMutex);
+    LeaveCriticalSection(&this->indexMutex);
+
+    return isChanged;
+}
+bool                        SegmentTimeline::StartsAfter        (uint64_t time, const IndexEntry& entry)
+{
+    return time < entry.startTime;
+}
+bool                        SegmentTimeline::FirstIndexAfter    (uint64_t index, const IndexEntry& entry)
+{
+    return index < entry.firstIndex;
+}
+uint64_t                    SegmentTimeline::EndOf              (const IndexEntry& entry)
+{
+    if (entry.count > (UINT64_MAX - entry.startTime) / entry.duration)
+        return UINT64_MAX;
+
+    return entry.startTime + entry.count * entry.duration;
+}
+void                        SegmentTimeline::BuildIndex         ()  const
+{
+    if (this->isIndexed)
+        return;
+
+    this->index.clear();
+    this->index.reserve(this->timelines.size());
+
+    uint64_t time   = 0;
+    uint64_t first  = 0;
+
+    for (size_t i = 0; i < this->timelines.size(); i++)
+    {
+        ITimeline *timeline = this->timelines.at(i);
+
+        /* an S element without duration describes no segment */
+        if (timeline->GetDuration() == 0)
+            continue;
+
+        IndexEntry entry;
+        entry.startTime     = std::max(time, timeline->GetStartTime());
+        entry.duration      = timeline->GetDuration();
+        entry.firstIndex    = first;
+        entry.count         = (uint64_t) timeline->GetRepeatCount() + 1;
+        entry.position      = i;
+
+        /* a negative repeat count lasts until the next S element, on the last one it never ends */
+        if (timeline->GetRepeatCount() == UINT32_MAX)
+        {
+            if (i + 1 == this->timelines.size())
+            {
+                entry.count = UINT64_MAX - first;
+                this->index.push_back(entry);
+                break;
+            }
+
+            uint64_t end = this->timelines.at(i + 1)->GetStartTime();
+            entry.count  = end > entry.startTime ? (end - entry.startTime + entry.duration - 1) / entry.duration : 0;
+        }
+
+        if (entry.count == 0)
+            continue;
+
+        this->index.push_back(entry);
+
+        time    = entry.startTime + entry.count * entry.duration;
+        first  += entry.count;
+    }
+
+    this->isIndexed = true;
+}
@@ -17,6 +17,8 @@
 #include "ISegmentTimeline.h"
 #include "AbstractMPDElement.h"
 #include "Timeline.h"
+#include "MPDUpdate.h"
+#include "../portable/MultiThreading.h"
 
 namespace dash
 {
@@ -28,11 +30,34 @@ namespace dash
                 SegmentTimeline             ();
                 virtual ~SegmentTimeline    ();
 
-                std::vector<ITimeline *>&   GetTimelines    ()  const;
-                void                        AddTimeline     (Timeline *timeline);
+                std::vector<ITimeline *>&   GetTimelines        ()  const;
+                uint64_t                    GetSegmentCount     ()  const;
+                bool                        FindSegmentByTime   (uint64_t time, uint64_t& index, uint64_t& startTime, uint64_t& duration) const;
+                bool                        FindSegmentByIndex  (uint64_t index, uint64_t& startTime, uint64_t& duration) const;
+
+                void                        AddTimeline         (Timeline *timeline);
+                bool                        Merge               (SegmentTimeline& newer, MPDUpdate& update);
 
             private:
-                std::vector<ITimeline *>    timelines;
+                /* one entry per S element, with its repeats expanded and its start resolved */
+                struct IndexEntry
+                {
+                    uint64_t    startTime;
+                    uint64_t    duration;
+                    uint64_t    firstIndex;
+                    uint64_t    count;
+                    size_t      position;
+                };
+
+                static bool                 StartsAfter         (uint64_t time, const IndexEntry& entry);
+                static bool                 FirstIndexAfter     (uint64_t index, const IndexEntry& entry);
+                static uint64_t             EndOf               (const IndexEntry& entry);
+                void                        BuildIndex          ()  const;
+
+                std::vector<ITimeline *>            timelines;
+                mutable std::vector<IndexEntry>     index;
+                mutable bool                        isIndexed;
+                mutable CRITICAL_SECTION            indexMutex;
         };
     }
 }
@@ -18,7 +18,8 @@ SegmentURL::SegmentURL    () :
             mediaURI(""),
             mediaRange(""),
             indexURI(""),
-            indexRange("")
+            indexRange(""),
+            baseUrlCache(NULL)
 {
 }
 SegmentURL::~SegmentURL   ()
@@ -57,22 +58,35 @@ void                SegmentURL::SetIndexRange   (const std::string& indexRange)
 {
     this->indexRange = indexRange;
 }
+void                SegmentURL::SetBaseUrlCache (BaseUrlCache *baseUrlCache)
+{
+    this->baseUrlCache = baseUrlCache;
+}
 ISegment*           SegmentURL::ToMediaSegment  (const std::vector<IBaseUrl *>& baseurls) const
 {
-    Segment *seg = new Segment();
-    
-    if(seg->Init(baseurls, this->mediaURI, this->mediaRange, dash::metrics::MediaSegment))
-        return seg;
-
-    delete(seg);
-
-    return NULL;
+    return this->ToSegment(baseurls, this->mediaURI, this->mediaRange, dash::metrics::MediaSegment);
 }
 ISegment*           SegmentURL::ToIndexSegment  (const std::vector<IBaseUrl *>& baseurls) const
 {
-    Segment *seg = new Segment();
-    
-    if(seg->Init(baseurls, this->indexURI, this->indexRange, dash::metrics::IndexSegment))
+    return this->ToSegment(baseurls, this->indexURI, this->indexRange, dash::metrics::IndexSegment);
+}
+ISegment*           SegmentURL::ToSegment       (const std::vector<IBaseUrl *>& baseurls, const std::string& uri, const std::string& range,
+                                                 dash::metrics::HTTPTransactionType type) const
+{
+    Segment *seg            = new Segment();
+    bool    isInitialized   = false;
+
+    if(this->baseUrlCache != NULL)
+    {
+        isInitialized = seg->Init(this->baseUrlCache->Acquire(baseurls), uri, range, type);
+        this->baseUrlCache->Release();
+    }
+    else
+    {
+        isInitialized = seg->Init(baseurls, uri, range, type);
+    }
+
+    if(isInitialized)
         return seg;
 
     delete(seg);
@@ -40,12 +40,19 @@ namespace dash
                 void    SetMediaRange   (const std::string& mediaRange);
                 void    SetIndexURI     (const std::string& indexURI);
                 void    SetIndexRange   (const std::string& indexRange);
+                void    SetBaseUrlCache (BaseUrlCache *baseUrlCache);
 
             private:
+                ISegment*   ToSegment   (const std::vector<IBaseUrl *>& baseurls, const std::string& uri, const std::string& range,
+                                         dash::metrics::HTTPTransactionType type) const;
+
                 std::string mediaURI;
                 std::string mediaRange;
                 std::string indexURI;
                 std::string indexRange;
+
+                /* kept by the segment list, so the urls of a list resolve their base once */
+                BaseUrlCache    *baseUrlCache;
         };
     }
 }
@@ -21,6 +21,16 @@ THREAD_HANDLE   CreateThreadPortable    (void *(*start_routine) (void *), void *
         return th;
     #endif
 }
+void            JoinThreadPortable      (THREAD_HANDLE th)
+{
+    #if defined _WIN32 || defined _WIN64
+        if(th)
+            WaitForSingleObject(th, INFINITE);
+    #else
+        if(th)
+            pthread_join(*th, NULL);
+    #endif
+}
 void            DestroyThreadPortable   (THREAD_HANDLE th)
 {
     #if !defined _WIN32 && !defined _WIN64
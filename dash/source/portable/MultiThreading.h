@@ -65,6 +65,7 @@
 #endif
 
 THREAD_HANDLE   CreateThreadPortable    (void *(*start_routine) (void *), void *arg);
+void            JoinThreadPortable      (THREAD_HANDLE th);
 void            DestroyThreadPortable   (THREAD_HANDLE th);
 
 #endif  // PORTABLE_MULTITHREADING_H_
\ No newline at end of file
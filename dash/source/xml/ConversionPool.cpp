@@ -0,0 +1,164 @@
+/*
+ * ConversionPool.cpp
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ConversionPool.h"
+#include "Node.h"
+#include <algorithm>
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+ConversionJob::ConversionJob    (Node *node, ConversionPool *pool) :
+               node             (node),
+               pool             (pool),
+               period           (NULL),
+               adaptationSet    (NULL),
+               isStarted        (false),
+               isDone           (false)
+{
+}
+ConversionJob::~ConversionJob   ()
+{
+    delete(this->node);
+    delete(this->period);
+    delete(this->adaptationSet);
+}
+
+void            ConversionJob::Wait                 ()
+{
+    this->pool->Wait(this);
+}
+Period*         ConversionJob::TakePeriod           ()
+{
+    Period *period = this->period;
+    this->period = NULL;
+    return period;
+}
+AdaptationSet*  ConversionJob::TakeAdaptationSet    ()
+{
+    AdaptationSet *adaptationSet = this->adaptationSet;
+    this->adaptationSet = NULL;
+    return adaptationSet;
+}
+void            ConversionJob::Run                  ()
+{
+    if (this->node->GetName() == "Period")
+        this->period = this->node->ToPeriod();
+    else
+        this->adaptationSet = this->node->ToAdaptationSet();
+
+    delete(this->node);
+    this->node = NULL;
+}
+
+ConversionPool::ConversionPool  (uint32_t threads) :
+                isStopping      (false)
+{
+    InitializeCriticalSection(&this->mutex);
+    InitializeConditionVariable(&this->queued);
+    InitializeConditionVariable(&this->finished);
+
+    for (uint32_t i = 0; i < threads; i++)
+    {
+        THREAD_HANDLE thread = CreateThreadPortable(ConversionPool::Work, this);
+        if (thread != NULL)
+            this->threads.push_back(thread);
+    }
+}
+ConversionPool::~ConversionPool ()
+{
+    EnterCriticalSection(&this->mutex);
+    this->isStopping = true;
+    WakeAllConditionVariable(&this->queued);
+    LeaveCriticalSection(&this->mutex);
+
+    for (size_t i = 0; i < this->threads.size(); i++)
+    {
+        JoinThreadPortable(this->threads.at(i));
+        DestroyThreadPortable(this->threads.at(i));
+    }
+
+    /* only left over if no worker could be started */
+    EnterCriticalSection(&this->mutex);
+    while (!this->queue.empty())
+    {
+        ConversionJob *job = this->queue.front();
+        this->queue.pop_front();
+        this->Run(job);
+    }
+    LeaveCriticalSection(&this->mutex);
+
+    DeleteConditionVariable(&this->queued);
+    DeleteConditionVariable(&this->finished);
+    DeleteCriticalSection(&this->mutex);
+}
+
+ConversionJob*  ConversionPool::Submit  (Node *node)
+{
+    ConversionJob *job = new ConversionJob(node, this);
+
+    EnterCriticalSection(&this->mutex);
+    this->queue.push_back(job);
+    WakeConditionVariable(&this->queued);
+    LeaveCriticalSection(&this->mutex);
+
+    return job;
+}
+void            ConversionPool::Wait    (ConversionJob *job)
+{
+    EnterCriticalSection(&this->mutex);
+
+    /* a job nobody picked up yet is converted right here instead of waiting for a worker */
+    if (!job->isStarted)
+    {
+        this->queue.erase(std::find(this->queue.begin(), this->queue.end(), job));
+        this->Run(job);
+    }
+
+    while (!job->isDone)
+        SleepConditionVariableCS(&this->finished, &this->mutex, INFINITE);
+
+    LeaveCriticalSection(&this->mutex);
+}
+void*           ConversionPool::Work    (void *pool)
+{
+    ConversionPool *self = (ConversionPool *) pool;
+
+    EnterCriticalSection(&self->mutex);
+
+    while (true)
+    {
+        while (self->queue.empty() && !self->isStopping)
+            SleepConditionVariableCS(&self->queued, &self->mutex, INFINITE);
+
+        if (self->queue.empty())
+            break;
+
+        ConversionJob *job = self->queue.front();
+        self->queue.pop_front();
+        self->Run(job);
+    }
+
+    LeaveCriticalSection(&self->mutex);
+    return NULL;
+}
+void            ConversionPool::Run     (ConversionJob *job)
+{
+    /* called and returning with the mutex held, the conversion itself runs without it */
+    job->isStarted = true;
+    LeaveCriticalSection(&this->mutex);
+
+    job->Run();
+
+    EnterCriticalSection(&this->mutex);
+    job->isDone = true;
+    WakeAllConditionVariable(&this->finished);
+}
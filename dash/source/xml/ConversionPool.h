@@ -0,0 +1,80 @@
+/*
+ * ConversionPool.h
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef CONVERSIONPOOL_H_
+#define CONVERSIONPOOL_H_
+
+#include "config.h"
+
+#include <deque>
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class Period;
+        class AdaptationSet;
+    }
+    namespace xml
+    {
+        class Node;
+        class ConversionPool;
+
+        /* one Period or AdaptationSet subtree waiting to be converted, its node is deleted once done */
+        class ConversionJob
+        {
+            public:
+                ConversionJob           (Node *node, ConversionPool *pool);
+                virtual ~ConversionJob  ();
+
+                void                        Wait                ();
+                dash::mpd::Period*          TakePeriod          ();
+                dash::mpd::AdaptationSet*   TakeAdaptationSet   ();
+
+            private:
+                void    Run ();
+
+                Node                        *node;
+                ConversionPool              *pool;
+                dash::mpd::Period           *period;
+                dash::mpd::AdaptationSet    *adaptationSet;
+                bool                        isStarted;
+                bool                        isDone;
+
+                friend class ConversionPool;
+        };
+
+        /* converts independent subtrees on worker threads while the document is still being read */
+        class ConversionPool
+        {
+            public:
+                ConversionPool          (uint32_t threads);
+                virtual ~ConversionPool ();
+
+                ConversionJob*  Submit  (Node *node);
+                void            Wait    (ConversionJob *job);
+
+            private:
+                static void*    Work    (void *pool);
+                void            Run     (ConversionJob *job);
+
+                CRITICAL_SECTION                mutex;
+                CONDITION_VARIABLE              queued;
+                CONDITION_VARIABLE              finished;
+                std::deque<ConversionJob *>     queue;
+                std::vector<THREAD_HANDLE>      threads;
+                bool                            isStopping;
+        };
+    }
+}
+
+#endif /* CONVERSIONPOOL_H_ */
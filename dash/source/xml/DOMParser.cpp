@@ -15,38 +15,139 @@ using namespace dash::xml;
 using namespace dash::helpers;
 
 DOMParser::DOMParser    (std::string url) :
-           url          (url),
-           reader       (NULL),
-           root         (NULL)
+           reader               (NULL),
+           root                 (NULL),
+           url                  (url),
+           buffer               (NULL),
+           length               (0),
+           conversionThreads    (0),
+           pool                 (NULL),
+           snapshot             (NULL),
+           statistics           (NULL)
+{
+    this->Init();
+}
+DOMParser::DOMParser    (std::string url, const char *buffer, size_t length) :
+           reader               (NULL),
+           root                 (NULL),
+           url                  (url),
+           buffer               (buffer),
+           length               (length),
+           conversionThreads    (0),
+           pool                 (NULL),
+           snapshot             (NULL),
+           statistics           (NULL)
 {
     this->Init();
 }
 DOMParser::~DOMParser   ()
 {
     xmlCleanupParser();
+
+    /* the nodes may still wait on conversions, so the pool goes last */
     delete(this->root);
+    delete(this->pool);
+    delete(this->snapshot);
 }
 
 Node*   DOMParser::GetRootNode              () const
 {
     return this->root;
 }
+void    DOMParser::SetConversionThreads     (uint32_t threads)
+{
+    this->conversionThreads = threads;
+}
+void    DOMParser::SetStatistics            (dash::metrics::ParseStatistics *statistics)
+{
+    this->statistics = statistics;
+}
 bool    DOMParser::Parse                    ()
 {
-    this->reader = xmlReaderForFile(this->url.c_str(), NULL, 0);
+    uint64_t start = Time::GetMonotonicTimeInUs();
+
+    /* a document handed over in memory is parsed as is, the url only serves as its base */
+    if(this->buffer != NULL && this->length > INT_MAX)
+        return false;
+    else if(this->buffer != NULL)
+        this->reader = xmlReaderForMemory(this->buffer, (int) this->length, this->url.c_str(), NULL, 0);
+    else
+        this->reader = xmlReaderForFile(this->url.c_str(), NULL, 0);
 
     if(this->reader == NULL)
         return false;
 
-    if(xmlTextReaderRead(this->reader)) 
+    if(this->conversionThreads > 0 && this->pool == NULL)
+        this->pool = new ConversionPool(this->conversionThreads);
+
+    if(this->statistics != NULL)
+        this->statistics->SetDocumentSize(this->length);
+
+    uint64_t readTime       = this->statistics ? this->statistics->GetReadTime() : 0;
+    uint64_t conversionTime = this->statistics ? this->statistics->GetConversionTime() : 0;
+
+    if(this->Read())
         this->root = this->ProcessNode();
 
-    if(this->root == NULL)
+    xmlFreeTextReader(this->reader);
+    this->reader = NULL;
+    this->names.clear();
+
+    this->SetMPDPath();
+
+    /* whatever the reads and conversions left of the parse went into building the tree */
+    if(this->statistics != NULL)
+        this->statistics->AddBuildTime(Time::GetMonotonicTimeInUs() - start - (this->statistics->GetReadTime() - readTime) -
+                                       (this->statistics->GetConversionTime() - conversionTime));
+
+    return this->root != NULL;
+}
+bool    DOMParser::ParseSnapshot            (const char *snapshot, size_t length, const std::string &etag)
+{
+    SnapshotReader reader(snapshot, length);
+
+    if(!reader.IsValid(this->url, etag))
         return false;
 
-    xmlFreeTextReader(this->reader);
+    if(this->conversionThreads > 0 && this->pool == NULL)
+        this->pool = new ConversionPool(this->conversionThreads);
+
+    if(this->statistics != NULL)
+        this->statistics->SetDocumentSize(length);
+
+    uint64_t start          = Time::GetMonotonicTimeInUs();
+    uint64_t conversionTime = this->statistics != NULL ? this->statistics->GetConversionTime() : 0;
 
-    return true;
+    this->root = reader.Read(this->nameTable, this->pool, this->statistics);
+
+    this->SetMPDPath();
+
+    /* subtrees converted while the image was read count as conversion */
+    if(this->statistics != NULL)
+        this->statistics->AddBuildTime(Time::GetMonotonicTimeInUs() - start - (this->statistics->GetConversionTime() - conversionTime));
+
+    return this->root != NULL;
+}
+void    DOMParser::RecordSnapshot           (const std::string &etag)
+{
+    delete(this->snapshot);
+    this->snapshot = new SnapshotWriter(this->url, etag);
+}
+void    DOMParser::WriteSnapshot            (std::vector<char> &snapshot) const
+{
+    if(this->snapshot != NULL)
+        this->snapshot->Write(snapshot);
+}
+void    DOMParser::EndSnapshotNode          ()
+{
+    if(this->snapshot != NULL)
+        this->snapshot->EndNode();
+}
+void    DOMParser::SetMPDPath               ()
+{
+    /* keep the trailing slash, segment urls are resolved against it as against a directory */
+    if(this->root != NULL)
+        this->root->SetMPDPath(this->url.substr(0, this->url.find_last_of('/') + 1));
 }
 Node*   DOMParser::ProcessNode              ()
 {
@@ -56,75 +157,133 @@ Node*   DOMParser::ProcessNode              ()
     {
         while (type == Comment || type == WhiteSpace)
         {
-            xmlTextReaderRead(this->reader);
+            this->Read();
             type = xmlTextReaderNodeType(this->reader);
         }
 
+        if(xmlTextReaderConstName(this->reader) == NULL)
+            return NULL;
+
         Node *node = new Node();
         node->SetType(type);
-        node->SetMPDPath(Path::GetDirectoryPath(url));
 
-        if(xmlTextReaderConstName(this->reader) == NULL)
-        {
-            delete node;
-            return NULL;
-        }
+        if(this->statistics != NULL)
+            this->statistics->AddNode();
 
-        std::string name    = (const char *) xmlTextReaderConstName(this->reader);
-        int         isEmpty = xmlTextReaderIsEmptyElement(this->reader);
+        const Name          *name       = this->Intern(xmlTextReaderConstName(this->reader));
+        int                 isEmpty     = xmlTextReaderIsEmptyElement(this->reader);
 
         node->SetName(name);
 
+        if(this->snapshot != NULL)
+            this->snapshot->BeginNode(name, type, "");
+
         this->AddAttributesToNode(node);
 
         if(isEmpty)
+        {
+            this->EndSnapshotNode();
             return node;
+        }
 
         Node    *subnode    = NULL;
-        int     ret         = xmlTextReaderRead(this->reader);
+        int     ret         = this->Read();
 
         while(ret == 1)
         {
-            if(!strcmp(name.c_str(), (const char *) xmlTextReaderConstName(this->reader)))
+            if(!strcmp(name->text.c_str(), (const char *) xmlTextReaderConstName(this->reader)))
             {
+                this->EndSnapshotNode();
                 return node;
             }
 
             subnode = this->ProcessNode();
 
-            if(subnode != NULL)
+            /* known subtrees are turned into model objects as soon as they are complete */
+            if(subnode != NULL && !this->ConvertSubNode(node, subnode))
                 node->AddSubNode(subnode);
 
-            ret = xmlTextReaderRead(this->reader);
+            ret = this->Read();
         }
 
+        this->EndSnapshotNode();
         return node;
     } else if (type == Text)
     {
-       const char* text = (const char *) xmlTextReaderReadString(this->reader);
+       const char* text = (const char *) xmlTextReaderConstValue(this->reader);
 
        if(text != NULL)
        {
            Node *node = new Node();
            node->SetType(type);
            node->SetText(text);
+
+           if(this->statistics != NULL)
+               this->statistics->AddNode();
+
+           if(this->snapshot != NULL)
+           {
+               this->snapshot->BeginNode(NameTable::Find(""), type, text);
+               this->snapshot->EndNode();
+           }
            return node;
        }
     }
     return NULL;
 }
+int     DOMParser::Read                     ()
+{
+    /* the reader tokenizes on demand while the tree is built, so its share is only known by timing each read */
+    if(this->statistics == NULL)
+        return xmlTextReaderRead(this->reader);
+
+    uint64_t    start   = Time::GetMonotonicTimeInUs();
+    int         ret     = xmlTextReaderRead(this->reader);
+
+    this->statistics->AddReadTime(Time::GetMonotonicTimeInUs() - start);
+    return ret;
+}
+bool    DOMParser::ConvertSubNode           (Node *node, Node *subnode)
+{
+    if(this->statistics == NULL)
+        return node->ConvertSubNode(subnode, this->pool);
+
+    uint64_t    start       = Time::GetMonotonicTimeInUs();
+    bool        isConverted = node->ConvertSubNode(subnode, this->pool);
+
+    this->statistics->AddConversionTime(Time::GetMonotonicTimeInUs() - start);
+    return isConverted;
+}
 void    DOMParser::AddAttributesToNode      (Node *node)
 {
     if(xmlTextReaderHasAttributes(this->reader))
     {
         while(xmlTextReaderMoveToNextAttribute(this->reader))
         {
-            std::string key      = (const char *) xmlTextReaderConstName(this->reader);
-            std::string value    = (const char *) xmlTextReaderConstValue(this->reader);
-            node->AddAttribute(key, value);
+            const Name          *key    = this->Intern(xmlTextReaderConstName(this->reader));
+            const char          *value  = (const char *) xmlTextReaderConstValue(this->reader);
+            node->AddAttribute(key, value != NULL ? value : "");
+
+            if(this->statistics != NULL)
+                this->statistics->AddAttribute();
+
+            if(this->snapshot != NULL)
+                this->snapshot->AddAttribute(key, value != NULL ? value : "");
         }
     }
 }
+const Name*         DOMParser::Intern      (const xmlChar *name)
+{
+    /* the reader hands out names from its dictionary, so equal names come as the same pointer for the whole parse */
+    std::map<const xmlChar *, const Name *>::iterator it = this->names.find(name);
+
+    if(it != this->names.end())
+        return it->second;
+
+    const Name *atom = this->nameTable.Intern((const char *) name);
+    this->names[name] = atom;
+    return atom;
+}
 void    DOMParser::Print                    (Node *node, int offset)
 {
     std::stringstream ss;
@@ -15,8 +15,13 @@
 #include "config.h"
 
 #include "Node.h"
+#include "ConversionPool.h"
+#include "Snapshot.h"
 #include <libxml/xmlreader.h>
+#include <limits.h>
 #include "../helpers/Path.h"
+#include "../helpers/Time.h"
+#include "../metrics/ParseStatistics.h"
 
 namespace dash
 {
@@ -35,21 +40,40 @@ namespace dash
         {
             public:
                 DOMParser           (std::string url);
+                DOMParser           (std::string url, const char *buffer, size_t length);
                 virtual ~DOMParser  ();
 
-                bool    Parse       ();
-                Node*   GetRootNode () const;
-                void    Print       ();
+                bool    Parse                   ();
+                bool    ParseSnapshot           (const char *snapshot, size_t length, const std::string &etag);
+                void    RecordSnapshot          (const std::string &etag);
+                void    WriteSnapshot           (std::vector<char> &snapshot) const;
+                Node*   GetRootNode             () const;
+                void    Print                   ();
+                void    SetConversionThreads    (uint32_t threads);
+                void    SetStatistics           (dash::metrics::ParseStatistics *statistics);
 
             private:
                 xmlTextReaderPtr    reader;
                 Node                *root;
                 std::string         url;
+                std::map<const xmlChar *, const Name *> names;
+                NameTable           nameTable;
+                const char          *buffer;
+                size_t              length;
+                uint32_t            conversionThreads;
+                ConversionPool      *pool;
+                SnapshotWriter      *snapshot;
+                dash::metrics::ParseStatistics  *statistics;
 
                 void    Init                    ();
                 Node*   ProcessNode             ();
+                int     Read                    ();
+                bool    ConvertSubNode          (Node *node, Node *subnode);
                 void    AddAttributesToNode     (Node *node);
+                const Name*         Intern      (const xmlChar *name);
                 void    Print                   (Node *node, int offset);
+                void    SetMPDPath              ();
+                void    EndSnapshotNode         ();
         };
     }
 }
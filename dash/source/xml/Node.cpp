@@ -15,35 +15,213 @@
 using namespace dash::xml;
 using namespace dash::metrics;
 
-Node::Node  ()
+static const struct
+{
+    const char      *text;
+    AttributeKey    key;
+} knownAttributes[] =
+{
+    { "audioSamplingRate",          AttributeAudioSamplingRate },
+    { "availabilityEndTime",        AttributeAvailabilityEndTime },
+    { "availabilityStartTime",      AttributeAvailabilityStartTime },
+    { "bandwidth",                  AttributeBandwidth },
+    { "bitstreamSwitching",         AttributeBitstreamSwitching },
+    { "byteRange",                  AttributeByteRange },
+    { "codecs",                     AttributeCodecs },
+    { "codingDependency",           AttributeCodingDependency },
+    { "contains",                   AttributeContains },
+    { "contentComponent",           AttributeContentComponent },
+    { "contentType",                AttributeContentType },
+    { "d",                          AttributeD },
+    { "dependencyId",               AttributeDependencyId },
+    { "dependencyLevel",            AttributeDependencyLevel },
+    { "duration",                   AttributeDuration },
+    { "frameRate",                  AttributeFrameRate },
+    { "group",                      AttributeGroup },
+    { "height",                     AttributeHeight },
+    { "id",                         AttributeId },
+    { "index",                      AttributeIndex },
+    { "indexRange",                 AttributeIndexRange },
+    { "indexRangeExact",            AttributeIndexRangeExact },
+    { "initialization",             AttributeInitialization },
+    { "lang",                       AttributeLang },
+    { "level",                      AttributeLevel },
+    { "maxBandwidth",               AttributeMaxBandwidth },
+    { "maxFrameRate",               AttributeMaxFrameRate },
+    { "maxHeight",                  AttributeMaxHeight },
+    { "maximumSAPPeriod",           AttributeMaximumSAPPeriod },
+    { "maxPlayoutRate",             AttributeMaxPlayoutRate },
+    { "maxSegmentDuration",         AttributeMaxSegmentDuration },
+    { "maxSubsegmentDuration",      AttributeMaxSubsegmentDuration },
+    { "maxWidth",                   AttributeMaxWidth },
+    { "media",                      AttributeMedia },
+    { "mediaPresentationDuration",  AttributeMediaPresentationDuration },
+    { "mediaRange",                 AttributeMediaRange },
+    { "mediaStreamStructureId",     AttributeMediaStreamStructureId },
+    { "metrics",                    AttributeMetrics },
+    { "mimeType",                   AttributeMimeType },
+    { "minBandwidth",               AttributeMinBandwidth },
+    { "minBufferTime",              AttributeMinBufferTime },
+    { "minFrameRate",               AttributeMinFrameRate },
+    { "minHeight",                  AttributeMinHeight },
+    { "minimumUpdatePeriod",        AttributeMinimumUpdatePeriod },
+    { "minWidth",                   AttributeMinWidth },
+    { "moreInformationURL",         AttributeMoreInformationURL },
+    { "par",                        AttributePar },
+    { "presentationTimeOffset",     AttributePresentationTimeOffset },
+    { "profiles",                   AttributeProfiles },
+    { "qualityRanking",             AttributeQualityRanking },
+    { "r",                          AttributeR },
+    { "range",                      AttributeRange },
+    { "sar",                        AttributeSar },
+    { "scanType",                   AttributeScanType },
+    { "schemeIdUri",                AttributeSchemeIdUri },
+    { "segmentAlignment",           AttributeSegmentAlignment },
+    { "segmentProfiles",            AttributeSegmentProfiles },
+    { "serviceLocation",            AttributeServiceLocation },
+    { "sourceURL",                  AttributeSourceURL },
+    { "start",                      AttributeStart },
+    { "startNumber",                AttributeStartNumber },
+    { "starttime",                  AttributeStarttime },
+    { "startWithSAP",               AttributeStartWithSAP },
+    { "subsegmentAlignment",        AttributeSubsegmentAlignment },
+    { "subsegmentStartsWithSAP",    AttributeSubsegmentStartsWithSAP },
+    { "suggestedPresentationDelay", AttributeSuggestedPresentationDelay },
+    { "t",                          AttributeT },
+    { "timescale",                  AttributeTimescale },
+    { "timeShiftBufferDepth",       AttributeTimeShiftBufferDepth },
+    { "type",                       AttributeType },
+    { "value",                      AttributeValue },
+    { "width",                      AttributeWidth },
+    { "xlink:actuate",              AttributeXlinkActuate },
+    { "xlink:href",                 AttributeXlinkHref }
+};
+
+static const char *knownElements[] =
+{
+    "", "#text",
+    "Accessibility", "AdaptationSet", "AudioChannelConfiguration", "BaseURL", "BitstreamSwitching", "ContentComponent",
+    "ContentProtection", "Copyright", "EssentialProperty", "FramePacking", "Initialization", "Location", "Metrics", "MPD",
+    "Period", "ProgramInformation", "Range", "Rating", "Reporting", "Representation", "RepresentationIndex", "Role", "S",
+    "SegmentBase", "SegmentList", "SegmentTemplate", "SegmentTimeline", "SegmentURL", "Source", "SubRepresentation",
+    "Subset", "SupplementalProperty", "Title", "UTCTiming", "Viewpoint"
+};
+
+const std::set<Name>    NameTable::schemaNames  = NameTable::BuildSchemaNames();
+
+NameTable::NameTable    ()
+{
+}
+NameTable::~NameTable   ()
+{
+}
+std::set<Name>      NameTable::BuildSchemaNames ()
+{
+    std::set<Name>  names;
+    Name            entry;
+    entry.isSchema  = true;
+
+    for (size_t i = 0; i < sizeof(knownAttributes) / sizeof(knownAttributes[0]); i++)
+    {
+        entry.text  = knownAttributes[i].text;
+        entry.key   = knownAttributes[i].key;
+        names.insert(entry);
+    }
+
+    for (size_t i = 0; i < sizeof(knownElements) / sizeof(knownElements[0]); i++)
+    {
+        entry.text  = knownElements[i];
+        entry.key   = UnknownAttribute;
+        names.insert(entry);
+    }
+
+    return names;
+}
+const Name*         NameTable::Find     (const std::string &name)
+{
+    Name entry;
+    entry.text = name;
+
+    std::set<Name>::const_iterator it = NameTable::schemaNames.find(entry);
+    return it != NameTable::schemaNames.end() ? &*it : NULL;
+}
+const Name*         NameTable::Intern   (const std::string &name)
+{
+    const Name *atom = NameTable::Find(name);
+
+    if (atom != NULL)
+        return atom;
+
+    Name entry;
+    entry.text      = name;
+    entry.key       = UnknownAttribute;
+    entry.isSchema  = false;
+
+    return &*this->names.insert(entry).first;
+}
+
+Node::Node  () :
+    name(NameTable::Find("")),
+    type(0),
+    names(NULL),
+    hasAttributeMap(false)
 {
 }
 Node::Node  (const Node& other) :
+    attributes(other.attributes),
     name(other.name),
     text(other.text),
     type(other.type),
-    attributes(other.attributes)
+    mpdPath(other.mpdPath),
+    names(NULL),
+    hasAttributeMap(false)
 {
     for (size_t i = 0; i < other.subNodes.size(); i++)
         this->subNodes.push_back(new Node(*(other.subNodes.at(i))));
+
+    /* the names of the original stay with it */
+    if (other.names != NULL)
+        this->Detach(this->names);
 }
 Node::~Node ()
 {
     for(size_t i = 0; i < this->subNodes.size(); i++)
         delete(this->subNodes.at(i));
+
+    delete(this->names);
+
+    for(size_t i = 0; i < this->periods.size(); i++)
+        delete(this->periods.at(i));
+    for(size_t i = 0; i < this->timelines.size(); i++)
+        delete(this->timelines.at(i));
+    for(size_t i = 0; i < this->segmentURLs.size(); i++)
+        delete(this->segmentURLs.at(i));
+    for(size_t i = 0; i < this->jobs.size(); i++)
+    {
+        this->jobs.at(i)->Wait();
+        delete(this->jobs.at(i));
+    }
 }
 
-dash::mpd::ProgramInformation*              Node::ToProgramInformation  ()  const
+dash::mpd::ProgramInformation*              Node::ToProgramInformation  ()
 {
     dash::mpd::ProgramInformation *programInformation = new dash::mpd::ProgramInformation();
 
-    if (this->HasAttribute("lang"))
-    {
-        programInformation->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("moreInformationURL"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        programInformation->SetMoreInformationURL(this->GetAttributeValue("moreInformationURL"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeLang:
+                programInformation->SetLang(value);
+                break;
+            case AttributeMoreInformationURL:
+                programInformation->SetMoreInformationURL(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -63,78 +241,94 @@ dash::mpd::ProgramInformation*              Node::ToProgramInformation  ()  cons
             programInformation->SetCopyright(subNodes.at(i)->GetText());
             continue;
         }
-        programInformation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        programInformation->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    programInformation->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*programInformation);
     return programInformation;
 }
-dash::mpd::BaseUrl*                         Node::ToBaseUrl             ()  const
+dash::mpd::BaseUrl*                         Node::ToBaseUrl             ()
 {
     dash::mpd::BaseUrl *baseUrl = new dash::mpd::BaseUrl();
 
-    if(this->HasAttribute("serviceLocation"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        baseUrl->SetServiceLocation(this->GetAttributeValue("serviceLocation"));
-    }
-    if(this->HasAttribute("byteRange"))
-    {
-        baseUrl->SetByteRange(this->GetAttributeValue("byteRange"));
-    }
-    if (this->GetText() == "./")
-    {
-        baseUrl->SetUrl(this->mpdPath);
-    }
-    else 
-    {
-        baseUrl->SetUrl(this->GetText());
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeServiceLocation:
+                baseUrl->SetServiceLocation(value);
+                break;
+            case AttributeByteRange:
+                baseUrl->SetByteRange(value);
+                break;
+            default:
+                break;
+        }
     }
+    /* a relative url like ./ is resolved against the enclosing base urls when segments are built */
+    baseUrl->SetUrl(this->GetText());
 
-    baseUrl->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*baseUrl);
     return baseUrl;
 }
-dash::mpd::Descriptor*                      Node::ToDescriptor          ()  const
+dash::mpd::Descriptor*                      Node::ToDescriptor          ()
 {
     dash::mpd::Descriptor *descriptor = new dash::mpd::Descriptor();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("schemeIdUri"))
-    {
-        descriptor->SetSchemeIdUri(this->GetAttributeValue("schemeIdUri"));
-    }
-    if (this->HasAttribute("value"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        descriptor->SetValue(this->GetAttributeValue("value"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeSchemeIdUri:
+                descriptor->SetSchemeIdUri(value);
+                break;
+            case AttributeValue:
+                descriptor->SetValue(value);
+                break;
+            default:
+                break;
+        }
     }
     
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        descriptor->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        descriptor->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    descriptor->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*descriptor);
     return descriptor;
 }
-dash::mpd::ContentComponent*                Node::ToContentComponent    ()  const
+dash::mpd::ContentComponent*                Node::ToContentComponent    ()
 {
     dash::mpd::ContentComponent *contentComponent = new dash::mpd::ContentComponent();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("id"))
-    {
-        contentComponent->SetId(strtoul(this->GetAttributeValue("id").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("lang"))
-    {
-        contentComponent->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("contentType"))
-    {
-        contentComponent->SetContentType(this->GetAttributeValue("contentType"));
-    }
-    if (this->HasAttribute("par"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        contentComponent->SetPar(this->GetAttributeValue("par"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeId:
+                contentComponent->SetId(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeLang:
+                contentComponent->SetLang(value);
+                break;
+            case AttributeContentType:
+                contentComponent->SetContentType(value);
+                break;
+            case AttributePar:
+                contentComponent->SetPar(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -159,75 +353,94 @@ dash::mpd::ContentComponent*                Node::ToContentComponent    ()  cons
             contentComponent->AddViewpoint(subNodes.at(i)->ToDescriptor());
             continue;
         }
-        contentComponent->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        contentComponent->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    contentComponent->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*contentComponent);
     return contentComponent;
 }
-dash::mpd::URLType*                         Node::ToURLType             (HTTPTransactionType type)  const
+dash::mpd::URLType*                         Node::ToURLType             (HTTPTransactionType type)
 {
     dash::mpd::URLType* urlType = new dash::mpd::URLType();
     
-    if (this->HasAttribute("sourceURL"))
-    {
-        urlType->SetSourceURL(this->GetAttributeValue("sourceURL"));
-    }
-    if (this->HasAttribute("range"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        urlType->SetRange(this->GetAttributeValue("range"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeSourceURL:
+                urlType->SetSourceURL(value);
+                break;
+            case AttributeRange:
+                urlType->SetRange(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        urlType->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        urlType->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
     urlType->SetType(type);
-    urlType->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*urlType);
     return urlType;
 }
-dash::mpd::SegmentBase*                     Node::ToSegmentBase         ()  const
+dash::mpd::SegmentBase*                     Node::ToSegmentBase         ()
 {
     dash::mpd::SegmentBase* segmentBase = new dash::mpd::SegmentBase();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForSeg(*segmentBase);
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
         if (subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentBase->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            segmentBase->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    segmentBase->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*segmentBase);
     return segmentBase;
 }
-dash::mpd::Timeline*                        Node::ToTimeline            ()  const
+dash::mpd::Timeline*                        Node::ToTimeline            ()
 {
     dash::mpd::Timeline* timeline = new dash::mpd::Timeline();
 
-    if (this->HasAttribute("t"))
-    {
-        timeline->SetStartTime(strtoul(this->GetAttributeValue("t").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("d"))
-    {
-        timeline->SetDuration(strtoul(this->GetAttributeValue("d").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("r"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        timeline->SetRepeatCount(strtoul(this->GetAttributeValue("r").c_str(), NULL, 10));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeT:
+                timeline->SetStartTime(strtoull(value.c_str(), NULL, 10));
+                break;
+            case AttributeD:
+                timeline->SetDuration(strtoull(value.c_str(), NULL, 10));
+                break;
+            case AttributeR:
+                timeline->SetRepeatCount(strtoul(value.c_str(), NULL, 10));
+                break;
+            default:
+                break;
+        }
     }
 
-    timeline->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*timeline);
     return timeline;
 }
-dash::mpd::SegmentTimeline*                 Node::ToSegmentTimeline     ()  const
+dash::mpd::SegmentTimeline*                 Node::ToSegmentTimeline     ()
 {
     dash::mpd::SegmentTimeline* segmentTimeline = new dash::mpd::SegmentTimeline();
 
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    for(size_t i = 0; i < this->timelines.size(); i++)
+        segmentTimeline->AddTimeline(this->timelines.at(i));
+    this->timelines.clear();
+
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
     for(size_t i = 0; i < subNodes.size(); i++)
     {
         if (subNodes.at(i)->GetName() == "S")
@@ -235,57 +448,75 @@ dash::mpd::SegmentTimeline*                 Node::ToSegmentTimeline     ()  cons
             segmentTimeline->AddTimeline(subNodes.at(i)->ToTimeline());
             continue;
         }
-        segmentTimeline->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        segmentTimeline->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    segmentTimeline->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*segmentTimeline);
     return segmentTimeline;
 }
-dash::mpd::SegmentURL*                      Node::ToSegmentURL          ()  const
+dash::mpd::SegmentURL*                      Node::ToSegmentURL          ()
 {
     dash::mpd::SegmentURL *segmentUrl = new dash::mpd::SegmentURL();
 
-    if (this->HasAttribute("media"))
-    {
-        segmentUrl->SetMediaURI(this->GetAttributeValue("media"));
-    }
-    if (this->HasAttribute("mediaRange"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentUrl->SetMediaRange(this->GetAttributeValue("mediaRange"));
-    }
-    if (this->HasAttribute("index"))
-    {
-        segmentUrl->SetIndexURI(this->GetAttributeValue("index"));
-    }
-    if (this->HasAttribute("indexRange"))
-    {
-        segmentUrl->SetIndexRange(this->GetAttributeValue("indexRange"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeMedia:
+                segmentUrl->SetMediaURI(value);
+                break;
+            case AttributeMediaRange:
+                segmentUrl->SetMediaRange(value);
+                break;
+            case AttributeIndex:
+                segmentUrl->SetIndexURI(value);
+                break;
+            case AttributeIndexRange:
+                segmentUrl->SetIndexRange(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        segmentUrl->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        segmentUrl->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    segmentUrl->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*segmentUrl);
     return segmentUrl;
 }
-dash::mpd::SegmentList*                     Node::ToSegmentList         ()  const
+dash::mpd::SegmentList*                     Node::ToSegmentList         ()
 {
     dash::mpd::SegmentList* segmentList = new dash::mpd::SegmentList();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForMSeg(*segmentList);
 
-    if (this->HasAttribute("xlink:href"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentList->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
-    {
-        segmentList->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeXlinkHref:
+                segmentList->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                segmentList->SetXlinkActuate(value);
+                break;
+            default:
+                break;
+        }
     }
 
+    for(size_t i = 0; i < this->segmentURLs.size(); i++)
+        segmentList->AddSegmentURL(this->segmentURLs.at(i));
+    this->segmentURLs.clear();
+
     for(size_t i = 0; i < subNodes.size(); i++)
     {
         if (subNodes.at(i)->GetName() == "SegmentURL")
@@ -295,104 +526,121 @@ dash::mpd::SegmentList*                     Node::ToSegmentList         ()  cons
         }
         if (subNodes.at(i)->GetName() != "SegmentTimeline" && subNodes.at(i)->GetName() != "BitstreamSwitching" &&
             subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentList->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            segmentList->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    segmentList->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*segmentList);
     return segmentList;
 }
-dash::mpd::SegmentTemplate*                 Node::ToSegmentTemplate     ()  const
+dash::mpd::SegmentTemplate*                 Node::ToSegmentTemplate     ()
 {
     dash::mpd::SegmentTemplate *segmentTemplate = new dash::mpd::SegmentTemplate();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForMSeg(*segmentTemplate);
 
-    if (this->HasAttribute("media"))
-    {
-        segmentTemplate->SetMedia(this->GetAttributeValue("media"));
-    }
-    if (this->HasAttribute("index"))
-    {
-        segmentTemplate->SetIndex(this->GetAttributeValue("index"));
-    }
-    if (this->HasAttribute("initialization"))
-    {
-        segmentTemplate->SetInitialization(this->GetAttributeValue("initialization"));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentTemplate->SetBitstreamSwitching(this->GetAttributeValue("bitstreamSwitching"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeMedia:
+                segmentTemplate->SetMedia(value);
+                break;
+            case AttributeIndex:
+                segmentTemplate->SetIndex(value);
+                break;
+            case AttributeInitialization:
+                segmentTemplate->SetInitialization(value);
+                break;
+            case AttributeBitstreamSwitching:
+                segmentTemplate->SetBitstreamSwitching(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
         if (subNodes.at(i)->GetName() != "SegmentTimeline" && subNodes.at(i)->GetName() != "BitstreamSwitching" &&
             subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentTemplate->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            segmentTemplate->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    segmentTemplate->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*segmentTemplate);
     return segmentTemplate;
 }
-dash::mpd::SubRepresentation*               Node::ToSubRepresentation   ()  const
+dash::mpd::SubRepresentation*               Node::ToSubRepresentation   ()
 {
     dash::mpd::SubRepresentation* subRepresentation = new dash::mpd::SubRepresentation();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForRep(*subRepresentation);
 
-    if (this->HasAttribute("level"))
-    {
-        subRepresentation->SetLevel(strtoul(this->GetAttributeValue("level").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("dependencyLevel"))
-    {
-        subRepresentation->SetDependencyLevel(this->GetAttributeValue("dependencyLevel"));
-    }
-    if (this->HasAttribute("bandwidth"))
-    {
-        subRepresentation->SetBandWidth(strtoul(this->GetAttributeValue("bandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("contentComponent"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        subRepresentation->SetContentComponent(this->GetAttributeValue("contentComponent"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeLevel:
+                subRepresentation->SetLevel(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeDependencyLevel:
+                subRepresentation->SetDependencyLevel(value);
+                break;
+            case AttributeBandwidth:
+                subRepresentation->SetBandWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeContentComponent:
+                subRepresentation->SetContentComponent(value);
+                break;
+            default:
+                break;
+        }
     }
     for (size_t i = 0; i < subNodes.size(); i++)
     {
         if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            subRepresentation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            subRepresentation->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    subRepresentation->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*subRepresentation);
     return subRepresentation;
 }
-dash::mpd::Representation*                  Node::ToRepresentation      ()  const
+dash::mpd::Representation*                  Node::ToRepresentation      ()
 {
     dash::mpd::Representation* representation = new dash::mpd::Representation();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForRep(*representation);
 
-    if (this->HasAttribute("id"))
-    {
-        representation->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("bandwidth"))
-    {
-        representation->SetBandwidth(strtoul(this->GetAttributeValue("bandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("qualityRanking"))
-    {
-        representation->SetQualityRanking(strtoul(this->GetAttributeValue("qualityRanking").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("dependencyId"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        representation->SetDependencyId(this->GetAttributeValue("dependencyId"));
-    }
-    if (this->HasAttribute("mediaStreamStructureId"))
-    {
-        representation->SetMediaStreamStructureId(this->GetAttributeValue("mediaStreamStructureId"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeId:
+                representation->SetId(value);
+                break;
+            case AttributeBandwidth:
+                representation->SetBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeQualityRanking:
+                representation->SetQualityRanking(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeDependencyId:
+                representation->SetDependencyId(value);
+                break;
+            case AttributeMediaStreamStructureId:
+                representation->SetMediaStreamStructureId(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -423,94 +671,85 @@ dash::mpd::Representation*                  Node::ToRepresentation      ()  cons
             continue;
         }
         if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            representation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            representation->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    representation->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*representation);
     return representation;
 }
-dash::mpd::AdaptationSet*                   Node::ToAdaptationSet       ()  const
+dash::mpd::AdaptationSet*                   Node::ToAdaptationSet       ()
 {
     dash::mpd::AdaptationSet *adaptationSet = new dash::mpd::AdaptationSet();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForRep(*adaptationSet);
 
-    if (this->HasAttribute("xlink:href"))
-    {
-        adaptationSet->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
-    {
-        adaptationSet->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
-    }
-    if (this->HasAttribute("id"))
-    {
-        adaptationSet->SetId(strtoul(this->GetAttributeValue("id").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("group"))
-    {
-        adaptationSet->SetGroup(strtoul(this->GetAttributeValue("group").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("lang"))
-    {
-        adaptationSet->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("contentType"))
-    {
-        adaptationSet->SetContentType(this->GetAttributeValue("contentType"));
-    }
-    if (this->HasAttribute("par"))
-    {
-        adaptationSet->SetPar(this->GetAttributeValue("par"));
-    }
-    if (this->HasAttribute("minBandwidth"))
-    {
-        adaptationSet->SetMinBandwidth(strtoul(this->GetAttributeValue("minBandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxBandwidth"))
-    {
-        adaptationSet->SetMaxBandwidth(strtoul(this->GetAttributeValue("maxBandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minWidth"))
-    {
-        adaptationSet->SetMinWidth(strtoul(this->GetAttributeValue("minWidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxWidth"))
-    {
-        adaptationSet->SetMaxWidth(strtoul(this->GetAttributeValue("maxWidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minHeight"))
-    {
-        adaptationSet->SetMinHeight(strtoul(this->GetAttributeValue("minHeight").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxHeight"))
-    {
-        adaptationSet->SetMaxHeight(strtoul(this->GetAttributeValue("maxHeight").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minFrameRate"))
-    {
-        adaptationSet->SetMinFramerate(this->GetAttributeValue("minFrameRate"));
-    }
-    if (this->HasAttribute("maxFrameRate"))
-    {
-        adaptationSet->SetMaxFramerate(this->GetAttributeValue("maxFrameRate"));
-    }
-    if (this->HasAttribute("segmentAlignment"))
-    {
-        adaptationSet->SetSegmentAlignment(this->GetAttributeValue("segmentAlignment"));
-    }
-    if (this->HasAttribute("subsegmentAlignment"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        adaptationSet->SetSubsegmentAlignment(this->GetAttributeValue("subsegmentAlignment"));
-    }
-    if (this->HasAttribute("subsegmentStartsWithSAP"))
-    {
-        adaptationSet->SetMaxHeight((uint8_t) strtoul(this->GetAttributeValue("subsegmentStartsWithSAP").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
-    {
-        adaptationSet->SetBitstreamSwitching(dash::helpers::String::ToBool(this->GetAttributeValue("bitstreamSwitching")));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeXlinkHref:
+                adaptationSet->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                adaptationSet->SetXlinkActuate(value);
+                break;
+            case AttributeId:
+                adaptationSet->SetId(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeGroup:
+                adaptationSet->SetGroup(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeLang:
+                adaptationSet->SetLang(value);
+                break;
+            case AttributeContentType:
+                adaptationSet->SetContentType(value);
+                break;
+            case AttributePar:
+                adaptationSet->SetPar(value);
+                break;
+            case AttributeMinBandwidth:
+                adaptationSet->SetMinBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxBandwidth:
+                adaptationSet->SetMaxBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinWidth:
+                adaptationSet->SetMinWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxWidth:
+                adaptationSet->SetMaxWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinHeight:
+                adaptationSet->SetMinHeight(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxHeight:
+                adaptationSet->SetMaxHeight(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinFrameRate:
+                adaptationSet->SetMinFramerate(value);
+                break;
+            case AttributeMaxFrameRate:
+                adaptationSet->SetMaxFramerate(value);
+                break;
+            case AttributeSegmentAlignment:
+                adaptationSet->SetSegmentAlignment(value);
+                break;
+            case AttributeSubsegmentAlignment:
+                adaptationSet->SetSubsegmentAlignment(value);
+                break;
+            case AttributeSubsegmentStartsWithSAP:
+                adaptationSet->SetMaxHeight((uint8_t) strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeBitstreamSwitching:
+                adaptationSet->SetBitstreamSwitching(dash::helpers::String::ToBool(value));
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -566,52 +805,65 @@ dash::mpd::AdaptationSet*                   Node::ToAdaptationSet       ()  cons
             continue;
         }
         if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            adaptationSet->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+            adaptationSet->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    adaptationSet->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*adaptationSet);
     return adaptationSet;
 }
-dash::mpd::Subset*                          Node::ToSubset              ()  const
+dash::mpd::Subset*                          Node::ToSubset              ()
 {
     dash::mpd::Subset *subset = new dash::mpd::Subset();
 
-    if (this->HasAttribute("contains"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        subset->SetSubset(this->GetAttributeValue("contains"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeContains:
+                subset->SetSubset(value);
+                break;
+            default:
+                break;
+        }
     }
 
-    subset->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*subset);
     return subset;
 }
-dash::mpd::Period*                          Node::ToPeriod              ()  const
+dash::mpd::Period*                          Node::ToPeriod              ()
 {
     dash::mpd::Period *period = new dash::mpd::Period();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("xlink:href"))
-    {
-        period->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
-    {
-        period->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
-    }
-    if (this->HasAttribute("id"))
-    {
-        period->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("start"))
-    {
-        period->SetStart(this->GetAttributeValue("start"));
-    }
-    if (this->HasAttribute("duration"))
-    {
-        period->SetDuration(this->GetAttributeValue("duration"));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        period->SetBitstreamSwitching(dash::helpers::String::ToBool(this->GetAttributeValue("bitstreamSwitching")));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeXlinkHref:
+                period->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                period->SetXlinkActuate(value);
+                break;
+            case AttributeId:
+                period->SetId(value);
+                break;
+            case AttributeStart:
+                period->SetStart(value);
+                break;
+            case AttributeDuration:
+                period->SetDuration(value);
+                break;
+            case AttributeBitstreamSwitching:
+                period->SetBitstreamSwitching(dash::helpers::String::ToBool(value));
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -646,34 +898,59 @@ dash::mpd::Period*                          Node::ToPeriod              ()  cons
             period->SetSegmentTemplate(subNodes.at(i)->ToSegmentTemplate());
             continue;
         }
-        period->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        period->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }    
 
-    period->AddRawAttributes(this->attributes);
+    for(size_t i = 0; i < this->jobs.size(); i++)
+    {
+        this->jobs.at(i)->Wait();
+        period->AddAdaptationSet(this->jobs.at(i)->TakeAdaptationSet());
+        delete(this->jobs.at(i));
+    }
+    this->jobs.clear();
+
+    this->MoveRawAttributes(*period);
     return period;
 }
-dash::mpd::Range*                           Node::ToRange               ()  const
+dash::mpd::Range*                           Node::ToRange               ()
 {
     dash::mpd::Range* range = new dash::mpd::Range();
 
-    if (this->HasAttribute("starttime"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        range->SetStarttime(this->GetAttributeValue("starttime"));
-    }
-    if (this->HasAttribute("duration"))
-    {
-        range->SetDuration(this->GetAttributeValue("duration"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeStarttime:
+                range->SetStarttime(value);
+                break;
+            case AttributeDuration:
+                range->SetDuration(value);
+                break;
+            default:
+                break;
+        }
     }
 
     return range;
 }
-dash::mpd::Metrics*                         Node::ToMetrics             ()  const
+dash::mpd::Metrics*                         Node::ToMetrics             ()
 {
     dash::mpd::Metrics* metrics = new dash::mpd::Metrics();
 
-    if (this->HasAttribute("metrics"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        metrics->SetMetrics(this->GetAttributeValue("metrics"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeMetrics:
+                metrics->SetMetrics(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -688,65 +965,75 @@ dash::mpd::Metrics*                         Node::ToMetrics             ()  cons
             metrics->AddRange(subNodes.at(i)->ToRange());
             continue;
         }
-        metrics->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        metrics->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
-    metrics->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*metrics);
     return metrics;
 }
-dash::mpd::MPD*                             Node::ToMPD                 ()  const
+dash::mpd::MPD*                             Node::ToMPD                 ()
 {
     dash::mpd::MPD *mpd = new dash::mpd::MPD();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("id"))
-    {
-        mpd->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("profiles"))
-    {
-        mpd->SetProfiles(this->GetAttributeValue("profiles"));
-    }
-    if (this->HasAttribute("type"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        mpd->SetType(this->GetAttributeValue("type"));
-    }
-    if (this->HasAttribute("availabilityStartTime"))
-    {
-        mpd->SetAvailabilityStarttime(this->GetAttributeValue("availabilityStartTime"));
-    }
-    if (this->HasAttribute("availabilityEndTime"))
-    {
-        mpd->SetAvailabilityEndtime(this->GetAttributeValue("availabilityEndTime"));
-    }
-    if (this->HasAttribute("mediaPresentationDuration"))
-    {
-        mpd->SetMediaPresentationDuration(this->GetAttributeValue("mediaPresentationDuration"));
-    }
-    if (this->HasAttribute("minimumUpdatePeriod"))
-    {
-        mpd->SetMinimumUpdatePeriod(this->GetAttributeValue("minimumUpdatePeriod"));
-    }
-    if (this->HasAttribute("minBufferTime"))
-    {
-        mpd->SetMinBufferTime(this->GetAttributeValue("minBufferTime"));
-    }
-    if (this->HasAttribute("timeShiftBufferDepth"))
-    {
-        mpd->SetTimeShiftBufferDepth(this->GetAttributeValue("timeShiftBufferDepth"));
-    }
-    if (this->HasAttribute("suggestedPresentationDelay"))
-    {
-        mpd->SetSuggestedPresentationDelay(this->GetAttributeValue("suggestedPresentationDelay"));
-    }
-    if (this->HasAttribute("maxSegmentDuration"))
-    {
-        mpd->SetMaxSegmentDuration(this->GetAttributeValue("maxSegmentDuration"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeId:
+                mpd->SetId(value);
+                break;
+            case AttributeProfiles:
+                mpd->SetProfiles(value);
+                break;
+            case AttributeType:
+                mpd->SetType(value);
+                break;
+            case AttributeAvailabilityStartTime:
+                mpd->SetAvailabilityStarttime(value);
+                break;
+            case AttributeAvailabilityEndTime:
+                mpd->SetAvailabilityEndtime(value);
+                break;
+            case AttributeMediaPresentationDuration:
+                mpd->SetMediaPresentationDuration(value);
+                break;
+            case AttributeMinimumUpdatePeriod:
+                mpd->SetMinimumUpdatePeriod(value);
+                break;
+            case AttributeMinBufferTime:
+                mpd->SetMinBufferTime(value);
+                break;
+            case AttributeTimeShiftBufferDepth:
+                mpd->SetTimeShiftBufferDepth(value);
+                break;
+            case AttributeSuggestedPresentationDelay:
+                mpd->SetSuggestedPresentationDelay(value);
+                break;
+            case AttributeMaxSegmentDuration:
+                mpd->SetMaxSegmentDuration(value);
+                break;
+            case AttributeMaxSubsegmentDuration:
+                mpd->SetMaxSubsegmentDuration(value);
+                break;
+            default:
+                break;
+        }
     }
-    if (this->HasAttribute("maxSubsegmentDuration"))
+
+    for(size_t i = 0; i < this->periods.size(); i++)
+        mpd->AddPeriod(this->periods.at(i));
+    this->periods.clear();
+
+    for(size_t i = 0; i < this->jobs.size(); i++)
     {
-        mpd->SetMaxSubsegmentDuration(this->GetAttributeValue("maxSubsegmentDuration"));
+        this->jobs.at(i)->Wait();
+        mpd->AddPeriod(this->jobs.at(i)->TakePeriod());
+        delete(this->jobs.at(i));
     }
+    this->jobs.clear();
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
@@ -775,14 +1062,14 @@ dash::mpd::MPD*                             Node::ToMPD                 ()  cons
             mpd->AddMetrics(subNodes.at(i)->ToMetrics());
             continue;
         }
-        mpd->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        mpd->AddAdditionalSubNode((xml::INode *) this->ReleaseSubNode(i));
     }
 
     dash::mpd::BaseUrl *mpdPathBaseUrl = new dash::mpd::BaseUrl();
     mpdPathBaseUrl->SetUrl(mpdPath);
     mpd->SetMPDPathBaseUrl(mpdPathBaseUrl);
 
-    mpd->AddRawAttributes(this->attributes);
+    this->MoveRawAttributes(*mpd);
     return mpd;
 }
 void                                        Node::SetMPDPath            (std::string path)
@@ -790,6 +1077,95 @@ void                                        Node::SetMPDPath            (std::st
     this->mpdPath = path;
 }
 
+bool                                        Node::ConvertSubNode        (Node *node, ConversionPool *pool)
+{
+    /* periods and adaptation sets are independent of each other, with a pool they are converted on its threads */
+    if (pool != NULL && ((this->name->text == "MPD" && node->GetName() == "Period") || (this->name->text == "Period" && node->GetName() == "AdaptationSet")))
+    {
+        this->jobs.push_back(pool->Submit(node));
+        return true;
+    }
+
+    /* the bulky repetitive elements don't depend on their siblings, so they are converted right away and their nodes freed */
+    if (this->name->text == "MPD" && node->GetName() == "Period")
+        this->periods.push_back(node->ToPeriod());
+    else if (this->name->text == "SegmentTimeline" && node->GetName() == "S")
+        this->timelines.push_back(node->ToTimeline());
+    else if (this->name->text == "SegmentList" && node->GetName() == "SegmentURL")
+        this->segmentURLs.push_back(node->ToSegmentURL());
+    else
+        return false;
+
+    delete node;
+    return true;
+}
+Node*                                       Node::ReleaseSubNode        (size_t index)
+{
+    /* the tree is thrown away after conversion, so unknown elements are handed over instead of copied */
+    Node *node = this->subNodes.at(index);
+    this->subNodes.at(index) = NULL;
+    node->Freeze();
+    /* the names of the document go away with its parser */
+    node->Detach(node->names);
+    return node;
+}
+void                                        Node::Freeze                ()
+{
+    /* nodes handed to the model may be read from several threads, so nothing may be built lazily anymore */
+    this->GetAttributes();
+
+    for(size_t i = 0; i < this->subNodes.size(); i++)
+        this->subNodes.at(i)->Freeze();
+}
+void                                        Node::MoveRawAttributes     (dash::mpd::AbstractMPDElement& object)
+{
+    std::vector<std::pair<std::string, std::string> > raw(this->attributes.size());
+
+    for(size_t i = 0; i < this->attributes.size(); i++)
+    {
+        raw.at(i).first = this->attributes.at(i).first->text;
+        raw.at(i).second.swap(this->attributes.at(i).second);
+    }
+
+    this->attributes.clear();
+    this->hasAttributeMap = false;
+    object.AddRawAttributes(raw);
+}
+void                                        Node::Detach                (NameTable *&table)
+{
+    /* a table is only made for a subtree with names outside the schema */
+    if (!this->name->isSchema)
+    {
+        if (table == NULL)
+            table = new NameTable();
+        this->name = table->Intern(this->name->text);
+    }
+
+    for (size_t i = 0; i < this->attributes.size(); i++)
+    {
+        if (this->attributes.at(i).first->isSchema)
+            continue;
+
+        if (table == NULL)
+            table = new NameTable();
+        this->attributes.at(i).first = table->Intern(this->attributes.at(i).first->text);
+    }
+
+    for (size_t i = 0; i < this->subNodes.size(); i++)
+        this->subNodes.at(i)->Detach(table);
+}
+const Name*                                 Node::Intern                (const std::string &name)
+{
+    const Name *atom = NameTable::Find(name);
+
+    if (atom != NULL)
+        return atom;
+
+    if (this->names == NULL)
+        this->names = new NameTable();
+
+    return this->names->Intern(name);
+}
 const std::vector<INode*>&                  Node::GetNodes              ()  const
 {
     return (std::vector<INode*> &) this->subNodes;
@@ -804,36 +1180,56 @@ void                                        Node::AddSubNode            (Node *n
 }
 const std::string&                          Node::GetName               ()  const
 {
-    return this->name;
+    return this->name->text;
 }
 void                                        Node::SetName               (const std::string &name)
+{
+    this->name = this->Intern(name);
+}
+void                                        Node::SetName               (const Name *name)
 {
     this->name = name;
 }
-const std::string&                          Node::GetAttributeValue     (std::string key)   const
+const std::string&                          Node::GetAttributeValue     (const std::string &key)    const
 {
-    //return this->attributes[key];
-    return this->attributes.find(key)->second;
+    /* elements carry a handful of attributes, a linear scan beats any tree */
+    for(size_t i = 0; i < this->attributes.size(); i++)
+        if (this->attributes.at(i).first->text == key)
+            return this->attributes.at(i).second;
+
+    return NameTable::Find("")->text;
 }
 bool                                        Node::HasAttribute          (const std::string& name) const
 {
-    if(this->attributes.find(name) != this->attributes.end())
-        return true;
+    for(size_t i = 0; i < this->attributes.size(); i++)
+        if (this->attributes.at(i).first->text == name)
+            return true;
 
     return false;
 }
 void                                        Node::AddAttribute          (const std::string &key, const std::string &value)
 {
-    this->attributes[key] = value;
+    this->AddAttribute(this->Intern(key), value.c_str());
+}
+void                                        Node::AddAttribute          (const Name *key, const char *value)
+{
+    size_t i = 0;
+    while (i < this->attributes.size() && this->attributes.at(i).first != key)
+        i++;
+
+    if (i == this->attributes.size())
+        this->attributes.push_back(std::make_pair(key, std::string()));
+
+    this->attributes.at(i).second.assign(value);
+    this->hasAttributeMap = false;
 }
 std::vector<std::string>                    Node::GetAttributeKeys      ()  const
 {
     std::vector<std::string> keys;
-    std::map<std::string, std::string>::const_iterator it;
 
-    for(it = this->attributes.begin(); it != this->attributes.end(); ++it)
+    for(size_t i = 0; i < this->attributes.size(); i++)
     {
-        keys.push_back(it->first);
+        keys.push_back(this->attributes.at(i).first->text);
     }
     return keys;
 }
@@ -841,7 +1237,7 @@ bool                                        Node::HasText               ()  cons
 {
     return false;
 }
-std::string                                 Node::GetText               () const
+const std::string&                          Node::GetText               () const
 {
     if(this->type == 3)
         return this->text;
@@ -850,7 +1246,7 @@ std::string                                 Node::GetText               () const
         if(this->subNodes.size())
             return this->subNodes[0]->GetText();
         else
-            return "";
+            return NameTable::Find("")->text;
     }
 }
 void                                        Node::SetText               (const std::string &text)
@@ -859,7 +1255,7 @@ void                                        Node::SetText               (const s
 }
 void                                        Node::Print                 (std::ostream &stream)  const
 {
-    stream << this->name;
+    stream << this->name->text;
     std::vector<std::string> keys = this->GetAttributeKeys();
     for(size_t i = 0; i < keys.size(); i++)
         stream << " " << keys.at(i) << "=" << this->GetAttributeValue(keys.at(i));
@@ -868,7 +1264,16 @@ void                                        Node::Print                 (std::os
 }
 const std::map<std::string,std::string>&    Node::GetAttributes         ()  const
 {
-    return this->attributes;
+    if (!this->hasAttributeMap)
+    {
+        this->attributeMap.clear();
+        for(size_t i = 0; i < this->attributes.size(); i++)
+            this->attributeMap[this->attributes.at(i).first->text] = this->attributes.at(i).second;
+
+        this->hasAttributeMap = true;
+    }
+
+    return this->attributeMap;
 }
 int                                         Node::GetType               ()  const
 {
@@ -878,65 +1283,61 @@ void                                        Node::SetType               (int typ
 {
     this->type = type;
 }
-void                                        Node::SetCommonValuesForRep (dash::mpd::RepresentationBase& object) const
+void                                        Node::SetCommonValuesForRep (dash::mpd::RepresentationBase& object)
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("profiles"))
-    {
-        object.SetProfiles(this->GetAttributeValue("profiles"));
-    }
-    if (this->HasAttribute("width"))
-    {
-        object.SetWidth(strtoul(this->GetAttributeValue("width").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("height"))
-    {
-        object.SetHeight(strtoul(this->GetAttributeValue("height").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("sar"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        object.SetSar(this->GetAttributeValue("sar"));
-    }
-    if (this->HasAttribute("frameRate"))
-    {
-        object.SetFrameRate(this->GetAttributeValue("frameRate"));
-    }
-    if (this->HasAttribute("audioSamplingRate"))
-    {
-        object.SetAudioSamplingRate(this->GetAttributeValue("audioSamplingRate"));
-    }
-    if (this->HasAttribute("mimeType"))
-    {
-        object.SetMimeType(this->GetAttributeValue("mimeType"));
-    }
-    if (this->HasAttribute("segmentProfiles"))
-    {
-        object.SetSegmentProfiles(this->GetAttributeValue("segmentProfiles"));
-    }
-    if (this->HasAttribute("codecs"))
-    {
-        object.SetCodecs(this->GetAttributeValue("codecs"));
-    }
-    if (this->HasAttribute("maximumSAPPeriod"))
-    {
-        object.SetMaximumSAPPeriod(strtod(this->GetAttributeValue("maximumSAPPeriod").c_str(), NULL));
-    }
-    if (this->HasAttribute("startWithSAP"))
-    {
-        object.SetStartWithSAP((uint8_t) strtoul(this->GetAttributeValue("startWithSAP").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxPlayoutRate"))
-    {
-        object.SetMaxPlayoutRate(strtod(this->GetAttributeValue("maxPlayoutRate").c_str(), NULL));
-    }
-    if (this->HasAttribute("codingDependency"))
-    {
-        object.SetCodingDependency(dash::helpers::String::ToBool(this->GetAttributeValue("codingDependency")));
-    }
-    if (this->HasAttribute("scanType"))
-    {
-        object.SetScanType(this->GetAttributeValue("scanType"));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeProfiles:
+                object.SetProfiles(value);
+                break;
+            case AttributeWidth:
+                object.SetWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeHeight:
+                object.SetHeight(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeSar:
+                object.SetSar(value);
+                break;
+            case AttributeFrameRate:
+                object.SetFrameRate(value);
+                break;
+            case AttributeAudioSamplingRate:
+                object.SetAudioSamplingRate(value);
+                break;
+            case AttributeMimeType:
+                object.SetMimeType(value);
+                break;
+            case AttributeSegmentProfiles:
+                object.SetSegmentProfiles(value);
+                break;
+            case AttributeCodecs:
+                object.SetCodecs(value);
+                break;
+            case AttributeMaximumSAPPeriod:
+                object.SetMaximumSAPPeriod(strtod(value.c_str(), NULL));
+                break;
+            case AttributeStartWithSAP:
+                object.SetStartWithSAP((uint8_t) strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxPlayoutRate:
+                object.SetMaxPlayoutRate(strtod(value.c_str(), NULL));
+                break;
+            case AttributeCodingDependency:
+                object.SetCodingDependency(dash::helpers::String::ToBool(value));
+                break;
+            case AttributeScanType:
+                object.SetScanType(value);
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -958,25 +1359,31 @@ void                                        Node::SetCommonValuesForRep (dash::m
         }
     }
 }
-void                                        Node::SetCommonValuesForSeg (dash::mpd::SegmentBase& object) const
+void                                        Node::SetCommonValuesForSeg (dash::mpd::SegmentBase& object)
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
-    if (this->HasAttribute("timescale"))
-    {
-        object.SetTimescale(strtoul(this->GetAttributeValue("timescale").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("presentationTimeOffset"))
-    {
-        object.SetPresentationTimeOffset(strtoul(this->GetAttributeValue("presentationTimeOffset").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("indexRange"))
-    {
-        object.SetIndexRange(this->GetAttributeValue("indexRange"));
-    }
-    if (this->HasAttribute("indexRangeExact"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        object.SetIndexRangeExact(dash::helpers::String::ToBool(this->GetAttributeValue("indexRangeExact")));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeTimescale:
+                object.SetTimescale(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributePresentationTimeOffset:
+                object.SetPresentationTimeOffset(strtoull(value.c_str(), NULL, 10));
+                break;
+            case AttributeIndexRange:
+                object.SetIndexRange(value);
+                break;
+            case AttributeIndexRangeExact:
+                object.SetIndexRangeExact(dash::helpers::String::ToBool(value));
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -993,19 +1400,27 @@ void                                        Node::SetCommonValuesForSeg (dash::m
         }
     }
 }
-void                                        Node::SetCommonValuesForMSeg(dash::mpd::MultipleSegmentBase& object) const
+void                                        Node::SetCommonValuesForMSeg(dash::mpd::MultipleSegmentBase& object)
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    const std::vector<Node *>& subNodes = this->GetSubNodes();
 
     SetCommonValuesForSeg(object);
 
-    if (this->HasAttribute("duration"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        object.SetDuration(strtoul(this->GetAttributeValue("duration").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("startNumber"))
-    {
-        object.SetStartNumber(strtoul(this->GetAttributeValue("startNumber").c_str(), NULL, 10));
+        const std::string& value = this->attributes.at(i).second;
+
+        switch (this->attributes.at(i).first->key)
+        {
+            case AttributeDuration:
+                object.SetDuration(strtoull(value.c_str(), NULL, 10));
+                break;
+            case AttributeStartNumber:
+                object.SetStartNumber(strtoull(value.c_str(), NULL, 10));
+                break;
+            default:
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
@@ -14,8 +14,11 @@
 
 #include "config.h"
 
+#include <set>
+
 #include "INode.h"
 #include "../helpers/String.h"
+#include "../mpd/AbstractMPDElement.h"
 #include "../mpd/AdaptationSet.h"
 #include "../mpd/BaseUrl.h"
 #include "../mpd/ContentComponent.h"
@@ -37,11 +40,121 @@
 #include "../mpd/Subset.h"
 #include "../mpd/URLType.h"
 #include "IHTTPTransaction.h"
+#include "ConversionPool.h"
 
 namespace dash
 {
     namespace xml
     {
+        /* attributes of the MPD schema that the conversion looks at, interned names carry them so it can switch over them */
+        enum AttributeKey
+        {
+            UnknownAttribute,
+            AttributeAudioSamplingRate,
+            AttributeAvailabilityEndTime,
+            AttributeAvailabilityStartTime,
+            AttributeBandwidth,
+            AttributeBitstreamSwitching,
+            AttributeByteRange,
+            AttributeCodecs,
+            AttributeCodingDependency,
+            AttributeContains,
+            AttributeContentComponent,
+            AttributeContentType,
+            AttributeD,
+            AttributeDependencyId,
+            AttributeDependencyLevel,
+            AttributeDuration,
+            AttributeFrameRate,
+            AttributeGroup,
+            AttributeHeight,
+            AttributeId,
+            AttributeIndex,
+            AttributeIndexRange,
+            AttributeIndexRangeExact,
+            AttributeInitialization,
+            AttributeLang,
+            AttributeLevel,
+            AttributeMaxBandwidth,
+            AttributeMaxFrameRate,
+            AttributeMaxHeight,
+            AttributeMaximumSAPPeriod,
+            AttributeMaxPlayoutRate,
+            AttributeMaxSegmentDuration,
+            AttributeMaxSubsegmentDuration,
+            AttributeMaxWidth,
+            AttributeMedia,
+            AttributeMediaPresentationDuration,
+            AttributeMediaRange,
+            AttributeMediaStreamStructureId,
+            AttributeMetrics,
+            AttributeMimeType,
+            AttributeMinBandwidth,
+            AttributeMinBufferTime,
+            AttributeMinFrameRate,
+            AttributeMinHeight,
+            AttributeMinimumUpdatePeriod,
+            AttributeMinWidth,
+            AttributeMoreInformationURL,
+            AttributePar,
+            AttributePresentationTimeOffset,
+            AttributeProfiles,
+            AttributeQualityRanking,
+            AttributeR,
+            AttributeRange,
+            AttributeSar,
+            AttributeScanType,
+            AttributeSchemeIdUri,
+            AttributeSegmentAlignment,
+            AttributeSegmentProfiles,
+            AttributeServiceLocation,
+            AttributeSourceURL,
+            AttributeStart,
+            AttributeStartNumber,
+            AttributeStarttime,
+            AttributeStartWithSAP,
+            AttributeSubsegmentAlignment,
+            AttributeSubsegmentStartsWithSAP,
+            AttributeSuggestedPresentationDelay,
+            AttributeT,
+            AttributeTimescale,
+            AttributeTimeShiftBufferDepth,
+            AttributeType,
+            AttributeValue,
+            AttributeWidth,
+            AttributeXlinkActuate,
+            AttributeXlinkHref
+        };
+
+        /* an interned element or attribute name */
+        struct Name
+        {
+            std::string     text;
+            AttributeKey    key;
+            bool            isSchema;
+
+            bool operator < (const Name &other) const { return this->text < other.text; }
+        };
+
+        /* the names of one document, the names of the MPD schema are shared by all documents and never copied */
+        class NameTable
+        {
+            public:
+                NameTable           ();
+                virtual ~NameTable  ();
+
+                const Name*         Intern  (const std::string &name);
+
+                /* the schema names are built before main and never change, so looking them up takes no lock */
+                static const Name*  Find    (const std::string &name);
+
+            private:
+                static std::set<Name>   BuildSchemaNames    ();
+
+                static const std::set<Name> schemaNames;
+                std::set<Name>              names;
+        };
+
         class Node : public INode
         {
             public:
@@ -53,51 +166,76 @@ namespace dash
                 const std::vector<Node *>&                  GetSubNodes         ()  const;
                 std::vector<std::string>                    GetAttributeKeys    ()  const;
                 const std::string&                          GetName             ()  const;
-                std::string                                 GetText             ()  const;
+                const std::string&                          GetText             ()  const;
                 const std::map<std::string, std::string>&   GetAttributes       ()  const;
                 int                                         GetType             ()  const;
                 void                                        SetType             (int type);
-                const std::string&                          GetAttributeValue   (std::string key) const;
+                const std::string&                          GetAttributeValue   (const std::string &key) const;
                 void                                        AddSubNode          (Node *node);
+                bool                                        ConvertSubNode      (Node *node, ConversionPool *pool);
                 void                                        SetName             (const std::string &name);
+                void                                        SetName             (const Name *name);
                 bool                                        HasAttribute        (const std::string& name) const;
                 void                                        AddAttribute        (const std::string &key, const std::string &value);
+                void                                        AddAttribute        (const Name *key, const char *value);
                 bool                                        HasText             ()  const;
                 void                                        SetText             (const std::string &text);
                 void                                        Print               (std::ostream &stream)  const;
-                dash::mpd::MPD*                             ToMPD               ()  const;
+                dash::mpd::MPD*                             ToMPD               ();
+                dash::mpd::Period*                          ToPeriod            ();
+                dash::mpd::AdaptationSet*                   ToAdaptationSet     ();
+                dash::mpd::SegmentList*                     ToSegmentList       ();
                 void                                        SetMPDPath          (std::string path);
 
             private:
-                void                                        SetCommonValuesForRep   (dash::mpd::RepresentationBase& object) const;
-                void                                        SetCommonValuesForSeg   (dash::mpd::SegmentBase& object) const;
-                void                                        SetCommonValuesForMSeg  (dash::mpd::MultipleSegmentBase& object) const;
-                dash::mpd::AdaptationSet*                   ToAdaptationSet         ()  const;
-                dash::mpd::BaseUrl*                         ToBaseUrl               ()  const;
-                dash::mpd::ContentComponent*                ToContentComponent      ()  const;
-                dash::mpd::Descriptor*                      ToDescriptor            ()  const;
-                dash::mpd::Metrics*                         ToMetrics               ()  const;
-                dash::mpd::Period*                          ToPeriod                ()  const;
-                dash::mpd::ProgramInformation*              ToProgramInformation    ()  const;
-                dash::mpd::Range*                           ToRange                 ()  const;
-                dash::mpd::Representation*                  ToRepresentation        ()  const;
-                dash::mpd::SegmentBase*                     ToSegmentBase           ()  const;
-                dash::mpd::SegmentList*                     ToSegmentList           ()  const;
-                dash::mpd::SegmentTemplate*                 ToSegmentTemplate       ()  const;
-                dash::mpd::Timeline*                        ToTimeline              ()  const;
-                dash::mpd::SegmentTimeline*                 ToSegmentTimeline       ()  const;
-                dash::mpd::SegmentURL*                      ToSegmentURL            ()  const;
-                dash::mpd::SubRepresentation*               ToSubRepresentation     ()  const;
-                dash::mpd::Subset*                          ToSubset                ()  const;
-                dash::mpd::URLType*                         ToURLType               (dash::metrics::HTTPTransactionType transActType)  const;
+                void                                        SetCommonValuesForRep   (dash::mpd::RepresentationBase& object);
+                void                                        SetCommonValuesForSeg   (dash::mpd::SegmentBase& object);
+                void                                        SetCommonValuesForMSeg  (dash::mpd::MultipleSegmentBase& object);
+                dash::mpd::BaseUrl*                         ToBaseUrl               ();
+                dash::mpd::ContentComponent*                ToContentComponent      ();
+                dash::mpd::Descriptor*                      ToDescriptor            ();
+                dash::mpd::Metrics*                         ToMetrics               ();
+                dash::mpd::ProgramInformation*              ToProgramInformation    ();
+                dash::mpd::Range*                           ToRange                 ();
+                dash::mpd::Representation*                  ToRepresentation        ();
+                dash::mpd::SegmentBase*                     ToSegmentBase           ();
+                dash::mpd::SegmentTemplate*                 ToSegmentTemplate       ();
+                dash::mpd::Timeline*                        ToTimeline              ();
+                dash::mpd::SegmentTimeline*                 ToSegmentTimeline       ();
+                dash::mpd::SegmentURL*                      ToSegmentURL            ();
+                dash::mpd::SubRepresentation*               ToSubRepresentation     ();
+                dash::mpd::Subset*                          ToSubset                ();
+                dash::mpd::URLType*                         ToURLType               (dash::metrics::HTTPTransactionType transActType);
+                Node*                                       ReleaseSubNode          (size_t index);
+                void                                        Freeze                  ();
+                void                                        Detach                  (NameTable *&table);
+                void                                        MoveRawAttributes       (dash::mpd::AbstractMPDElement& object);
+                const Name*                                 Intern                  (const std::string &name);
+
+                typedef std::vector<std::pair<const Name *, std::string> > AttributeList;
 
                 std::vector<Node *>                 subNodes;
-                std::map<std::string, std::string>  attributes;
-                std::string                         name;
+                AttributeList                       attributes;
+                const Name                          *name;
                 std::string                         text;
                 int                                 type;
                 std::string                         mpdPath;
 
+                /* the names no document owns, of nodes handed to the model or named by hand */
+                NameTable                           *names;
+
+                /* built when asked for through INode only, conversion reads the flat list */
+                mutable std::map<std::string, std::string>  attributeMap;
+                mutable bool                                hasAttributeMap;
+
+                /* subtrees converted while the document was still being read */
+                std::vector<dash::mpd::Period *>        periods;
+                std::vector<dash::mpd::Timeline *>      timelines;
+                std::vector<dash::mpd::SegmentURL *>    segmentURLs;
+                std::vector<ConversionJob *>            jobs;
+
+                friend class ConversionJob;
+
         };
     }
 }
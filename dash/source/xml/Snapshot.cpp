@@ -0,0 +1,309 @@
+/*
+ * Snapshot.cpp
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Snapshot.h"
+
+using namespace dash::xml;
+
+SnapshotWriter::SnapshotWriter  (const std::string &url, const std::string &etag)
+{
+    /* texts are mostly empty, at offset 0 they take a single byte */
+    this->AddString("");
+
+    this->url   = this->AddString(url);
+    this->etag  = this->AddString(etag);
+}
+SnapshotWriter::~SnapshotWriter ()
+{
+}
+
+void        SnapshotWriter::BeginNode       (const Name *name, int type, const std::string &text)
+{
+    if (!this->open.empty())
+        this->nodes.at(this->open.back()).subNodeCount++;
+
+    Record node;
+    node.name           = this->AddName(name);
+    node.type           = (uint32_t) type;
+    node.text           = this->AddString(text);
+    node.attributeCount = 0;
+    node.subNodeCount   = 0;
+
+    this->open.push_back(this->nodes.size());
+    this->nodes.push_back(node);
+}
+void        SnapshotWriter::AddAttribute    (const Name *name, const char *value)
+{
+    this->attributes.push_back(this->AddName(name));
+    this->attributes.push_back(this->AddString(value));
+    this->nodes.at(this->open.back()).attributeCount++;
+}
+void        SnapshotWriter::EndNode         ()
+{
+    this->open.pop_back();
+}
+void        SnapshotWriter::Write           (std::vector<char> &snapshot) const
+{
+    std::vector<unsigned char> names;
+    for (size_t i = 0; i < this->names.size(); i++)
+        SnapshotWriter::AppendNumber(names, this->names.at(i));
+
+    /* the attributes of each node follow it, in the order they were added */
+    std::vector<unsigned char>  nodes;
+    size_t                      attribute = 0;
+
+    for (size_t i = 0; i < this->nodes.size(); i++)
+    {
+        const Record& node = this->nodes.at(i);
+
+        SnapshotWriter::AppendNumber(nodes, node.name);
+        SnapshotWriter::AppendNumber(nodes, node.type);
+        SnapshotWriter::AppendNumber(nodes, node.text);
+        SnapshotWriter::AppendNumber(nodes, node.attributeCount);
+        SnapshotWriter::AppendNumber(nodes, node.subNodeCount);
+
+        for (uint32_t j = 0; j < 2 * node.attributeCount; j++)
+            SnapshotWriter::AppendNumber(nodes, this->attributes.at(attribute++));
+    }
+
+    SnapshotHeader header;
+    memcpy(header.magic, "LDMS", 4);
+    header.version      = SnapshotVersion;
+    header.byteOrder    = SnapshotByteOrder;
+    header.nameCount    = (uint32_t) this->names.size();
+    header.names        = sizeof(SnapshotHeader);
+    header.nodeCount    = (uint32_t) this->nodes.size();
+    header.nodes        = header.names + (uint32_t) names.size();
+    header.strings      = header.nodes + (uint32_t) nodes.size();
+    header.size         = header.strings + (uint32_t) this->strings.size();
+    header.url          = this->url;
+    header.etag         = this->etag;
+
+    snapshot.resize(header.size);
+
+    memcpy(&snapshot.at(0), &header, sizeof(SnapshotHeader));
+    if (!names.empty())
+        memcpy(&snapshot.at(header.names), &names.at(0), names.size());
+    if (!nodes.empty())
+        memcpy(&snapshot.at(header.nodes), &nodes.at(0), nodes.size());
+    memcpy(&snapshot.at(header.strings), &this->strings.at(0), this->strings.size());
+}
+uint32_t    SnapshotWriter::AddString       (const std::string &string)
+{
+    /* attribute values repeat a lot, think of S@d or the codecs of a ladder */
+    std::map<std::string, uint32_t>::iterator it = this->stringOffsets.find(string);
+
+    if (it != this->stringOffsets.end())
+        return it->second;
+
+    uint32_t offset = (uint32_t) this->strings.size();
+    this->strings.insert(this->strings.end(), string.begin(), string.end());
+    this->strings.push_back('\0');
+    this->stringOffsets[string] = offset;
+    return offset;
+}
+uint32_t    SnapshotWriter::AddName         (const Name *name)
+{
+    std::map<const Name *, uint32_t>::iterator it = this->nameIndices.find(name);
+
+    if (it != this->nameIndices.end())
+        return it->second;
+
+    uint32_t index = (uint32_t) this->names.size();
+    this->names.push_back(this->AddString(name->text));
+    this->nameIndices[name] = index;
+    return index;
+}
+void        SnapshotWriter::AppendNumber    (std::vector<unsigned char> &stream, uint32_t number)
+{
+    while (number >= 0x80)
+    {
+        stream.push_back((unsigned char) (number | 0x80));
+        number >>= 7;
+    }
+
+    stream.push_back((unsigned char) number);
+}
+
+SnapshotReader::SnapshotReader  (const char *data, size_t length) :
+                data        (data),
+                length      (length),
+                statistics  (NULL)
+{
+    /* the image needs no alignment, so the header is copied out */
+    if (this->data != NULL && this->length >= sizeof(SnapshotHeader))
+        memcpy(&this->header, this->data, sizeof(SnapshotHeader));
+    else
+        memset(&this->header, 0, sizeof(SnapshotHeader));
+}
+SnapshotReader::~SnapshotReader ()
+{
+}
+
+bool            SnapshotReader::IsValid     (const std::string &url, const std::string &etag) const
+{
+    /* images come from caches on disk, so nothing in them is trusted before it was checked */
+    const SnapshotHeader& header = this->header;
+
+    if (memcmp(header.magic, "LDMS", 4) != 0 || header.version != SnapshotVersion || header.byteOrder != SnapshotByteOrder)
+        return false;
+
+    if (header.size > this->length || header.names != sizeof(SnapshotHeader) || header.nodes < header.names ||
+        header.strings < header.nodes || header.strings >= header.size || this->data[header.size - 1] != '\0')
+        return false;
+
+    if (header.url >= header.size - header.strings || header.etag >= header.size - header.strings ||
+        url != this->data + header.strings + header.url || etag != this->data + header.strings + header.etag)
+        return false;
+
+    const unsigned char *position   = (const unsigned char *) this->data + header.names;
+    const unsigned char *end        = (const unsigned char *) this->data + header.nodes;
+    const char          *name       = NULL;
+
+    for (uint32_t i = 0; i < header.nameCount; i++)
+        if (!this->ReadString(position, end, name))
+            return false;
+
+    if (position != end)
+        return false;
+
+    /* the root's subtree has to cover the nodes exactly */
+    uint32_t nodeCount = 0;
+
+    position    = (const unsigned char *) this->data + header.nodes;
+    end         = (const unsigned char *) this->data + header.strings;
+
+    return this->SkipNode(position, end, nodeCount) && position == end && nodeCount == header.nodeCount;
+}
+Node*           SnapshotReader::Read        (NameTable &nameTable, ConversionPool *pool, dash::metrics::ParseStatistics *statistics)
+{
+    this->statistics = statistics;
+
+    /* names are interned once per image instead of once per occurrence */
+    const unsigned char *position   = (const unsigned char *) this->data + this->header.names;
+    const unsigned char *end        = (const unsigned char *) this->data + this->header.nodes;
+
+    this->names.resize(this->header.nameCount);
+    for (uint32_t i = 0; i < this->header.nameCount; i++)
+    {
+        const char *name = NULL;
+        this->ReadString(position, end, name);
+        this->names.at(i) = nameTable.Intern(name);
+    }
+
+    position    = (const unsigned char *) this->data + this->header.nodes;
+    end         = (const unsigned char *) this->data + this->header.strings;
+
+    return this->ReadNode(position, end, pool);
+}
+bool            SnapshotReader::ReadNumber  (const unsigned char *&position, const unsigned char *end, uint32_t &number) const
+{
+    number = 0;
+
+    for (int shift = 0; shift < 35 && position < end; shift += 7)
+    {
+        unsigned char byte = *position++;
+        number |= (uint32_t) (byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+
+    return false;
+}
+bool            SnapshotReader::ReadString  (const unsigned char *&position, const unsigned char *end, const char *&string) const
+{
+    /* the image ends with a null, so any offset into the strings is terminated */
+    uint32_t offset = 0;
+
+    if (!this->ReadNumber(position, end, offset) || offset >= this->header.size - this->header.strings)
+        return false;
+
+    string = this->data + this->header.strings + offset;
+    return true;
+}
+bool            SnapshotReader::SkipNode    (const unsigned char *&position, const unsigned char *end, uint32_t &nodeCount) const
+{
+    uint32_t    name            = 0;
+    uint32_t    type            = 0;
+    uint32_t    attributeCount  = 0;
+    uint32_t    subNodeCount    = 0;
+    const char  *string         = NULL;
+
+    if (!this->ReadNumber(position, end, name) || name >= this->header.nameCount || !this->ReadNumber(position, end, type) ||
+        !this->ReadString(position, end, string) || !this->ReadNumber(position, end, attributeCount) || !this->ReadNumber(position, end, subNodeCount))
+        return false;
+
+    for (uint32_t i = 0; i < attributeCount; i++)
+        if (!this->ReadNumber(position, end, name) || name >= this->header.nameCount || !this->ReadString(position, end, string))
+            return false;
+
+    nodeCount++;
+
+    for (uint32_t i = 0; i < subNodeCount; i++)
+        if (!this->SkipNode(position, end, nodeCount))
+            return false;
+
+    return true;
+}
+Node*           SnapshotReader::ReadNode    (const unsigned char *&position, const unsigned char *end, ConversionPool *pool)
+{
+    uint32_t    name            = 0;
+    uint32_t    type            = 0;
+    uint32_t    attributeCount  = 0;
+    uint32_t    subNodeCount    = 0;
+    const char  *text           = NULL;
+
+    this->ReadNumber(position, end, name);
+    this->ReadNumber(position, end, type);
+    this->ReadString(position, end, text);
+    this->ReadNumber(position, end, attributeCount);
+    this->ReadNumber(position, end, subNodeCount);
+
+    Node *node = new Node();
+    node->SetType((int) type);
+    node->SetName(this->names.at(name));
+
+    if (*text != '\0')
+        node->SetText(text);
+
+    for (uint32_t i = 0; i < attributeCount; i++)
+    {
+        const char *value = NULL;
+
+        this->ReadNumber(position, end, name);
+        this->ReadString(position, end, value);
+        node->AddAttribute(this->names.at(name), value);
+    }
+
+    /* the same as DOMParser::ProcessNode, so the model comes out the same */
+    for (uint32_t i = 0; i < subNodeCount; i++)
+    {
+        Node *subnode = this->ReadNode(position, end, pool);
+
+        if (!this->ConvertSubNode(node, subnode, pool))
+            node->AddSubNode(subnode);
+    }
+
+    return node;
+}
+bool            SnapshotReader::ConvertSubNode  (Node *node, Node *subnode, ConversionPool *pool)
+{
+    /* converting inline is conversion, not reading the image, the same as DOMParser::ConvertSubNode books it */
+    if (this->statistics == NULL)
+        return node->ConvertSubNode(subnode, pool);
+
+    uint64_t    start       = dash::helpers::Time::GetMonotonicTimeInUs();
+    bool        isConverted = node->ConvertSubNode(subnode, pool);
+
+    this->statistics->AddConversionTime(dash::helpers::Time::GetMonotonicTimeInUs() - start);
+    return isConverted;
+}
@@ -0,0 +1,122 @@
+/*
+ * Snapshot.h
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include "config.h"
+
+#include "Node.h"
+#include "ConversionPool.h"
+#include "../helpers/Time.h"
+#include "../metrics/ParseStatistics.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         * a parsed document as a compact, pointer free image that is read back without libxml2:
+         *
+         *   SnapshotHeader
+         *   names      the element and attribute names, as offsets into the strings
+         *   nodes      the elements and texts in document order, each followed by its subtree:
+         *              name, type, text, attribute count, subnode count, then name and value of each attribute
+         *   strings    null terminated, each distinct string once, the empty one first
+         *
+         * names and nodes are unsigned LEB128 numbers, names are indices into the name list, texts and values offsets into the strings.
+         * header offsets are relative to the start of the image, which needs no alignment, so it can be mapped from a file as is.
+         * the header is in the byte order of the machine that wrote it, an image of another byte order is refused like one of another version.
+         */
+        struct SnapshotHeader
+        {
+            char        magic[4];
+            uint32_t    version;
+            uint32_t    byteOrder;
+            uint32_t    size;
+            uint32_t    url;
+            uint32_t    etag;
+            uint32_t    nameCount;
+            uint32_t    names;
+            uint32_t    nodeCount;
+            uint32_t    nodes;
+            uint32_t    strings;
+        };
+
+        /* records the document while DOMParser reads it, the tree itself is consumed by the conversion */
+        class SnapshotWriter
+        {
+            public:
+                SnapshotWriter          (const std::string &url, const std::string &etag);
+                virtual ~SnapshotWriter ();
+
+                void    BeginNode       (const Name *name, int type, const std::string &text);
+                void    AddAttribute    (const Name *name, const char *value);
+                void    EndNode         ();
+                void    Write           (std::vector<char> &snapshot) const;
+
+            private:
+                uint32_t    AddString   (const std::string &string);
+                uint32_t    AddName     (const Name *name);
+
+                /* counts are only known once a node is complete, so nodes are encoded at the end */
+                struct Record
+                {
+                    uint32_t    name;
+                    uint32_t    type;
+                    uint32_t    text;
+                    uint32_t    attributeCount;
+                    uint32_t    subNodeCount;
+                };
+
+                static void AppendNumber    (std::vector<unsigned char> &stream, uint32_t number);
+
+                std::vector<Record>                 nodes;
+                std::vector<uint32_t>               attributes;
+                std::vector<uint32_t>               names;
+                std::vector<char>                   strings;
+                std::map<std::string, uint32_t>     stringOffsets;
+                std::map<const Name *, uint32_t>    nameIndices;
+                std::vector<size_t>                 open;
+                uint32_t                            url;
+                uint32_t                            etag;
+        };
+
+        /* rebuilds the tree from an image, converting subtrees the same way DOMParser does */
+        class SnapshotReader
+        {
+            public:
+                SnapshotReader          (const char *data, size_t length);
+                virtual ~SnapshotReader ();
+
+                bool    IsValid         (const std::string &url, const std::string &etag) const;
+                Node*   Read            (NameTable &nameTable, ConversionPool *pool, dash::metrics::ParseStatistics *statistics);
+
+            private:
+                bool            ReadNumber  (const unsigned char *&position, const unsigned char *end, uint32_t &number) const;
+                bool            ReadString  (const unsigned char *&position, const unsigned char *end, const char *&string) const;
+                bool            SkipNode    (const unsigned char *&position, const unsigned char *end, uint32_t &nodeCount) const;
+                Node*           ReadNode    (const unsigned char *&position, const unsigned char *end, ConversionPool *pool);
+                bool            ConvertSubNode  (Node *node, Node *subnode, ConversionPool *pool);
+
+                const char                  *data;
+                size_t                      length;
+                SnapshotHeader              header;
+                std::vector<const Name *>   names;
+                dash::metrics::ParseStatistics  *statistics;
+        };
+
+        static const uint32_t SnapshotVersion   = 1;
+        static const uint32_t SnapshotByteOrder = 0x01020304;
+    }
+}
+
+#endif /* SNAPSHOT_H_ */
@@ -0,0 +1,439 @@
+/*
+ * XLinkResolver.cpp
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "XLinkResolver.h"
+
+#include <algorithm>
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+/* remote elements may refer to further remote elements, or to themselves */
+const size_t    XLinkResolver::MaxRounds        = 4;
+const size_t    XLinkResolver::MaxDocuments     = 32;
+/* a stalled server must not hold up opening or refreshing the MPD for long */
+const long      XLinkResolver::ConnectTimeout   = 5000;
+const long      XLinkResolver::FetchTimeout     = 10000;
+const char      *XLinkResolver::ResolveToZero   = "urn:mpeg:dash:resolve-to-zero:2013";
+
+XLinkResolver::XLinkResolver    ()  :
+               connection       (NULL)
+{
+    InitializeCriticalSection(&this->mutex);
+}
+XLinkResolver::~XLinkResolver   ()
+{
+    DeleteCriticalSection(&this->mutex);
+}
+
+void    XLinkResolver::ResolveOnLoad    (MPD *mpd)
+{
+    /* whatever the references replaced goes with the update */
+    MPDUpdate update;
+    this->ResolveOnLoad(mpd, update);
+}
+void    XLinkResolver::SetConnection    (dash::network::IConnection *connection)
+{
+    this->connection = connection;
+}
+bool    XLinkResolver::Resolve          (MPD *mpd, const IMPDElement *element, MPDUpdate &update)
+{
+    std::vector<Link> links;
+    XLinkResolver::Collect(mpd, false, links);
+
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        if (links.at(i).element != element)
+            continue;
+
+        std::vector<Link> link(1, links.at(i));
+        this->Fetch(mpd, link);
+
+        if (!this->Apply(mpd, link.at(0), update))
+            return false;
+
+        /* the remote elements may carry references to be resolved on load themselves */
+        this->ResolveOnLoad(mpd, update);
+        return true;
+    }
+
+    return false;
+}
+void    XLinkResolver::ResolveOnLoad    (MPD *mpd, MPDUpdate &update)
+{
+    /* an element whose reference failed stays as it is, and is not tried again */
+    std::vector<IMPDElement *> failed;
+
+    for (size_t round = 0; round < XLinkResolver::MaxRounds; round++)
+    {
+        std::vector<Link> collected;
+        std::vector<Link> links;
+        XLinkResolver::Collect(mpd, true, collected);
+
+        for (size_t i = 0; i < collected.size(); i++)
+            if (std::find(failed.begin(), failed.end(), collected.at(i).element) == failed.end())
+                links.push_back(collected.at(i));
+
+        if (links.empty())
+            return;
+
+        this->Fetch(mpd, links);
+
+        /* links never nest within a round, so replacing one leaves the others valid */
+        for (size_t i = 0; i < links.size(); i++)
+            if (!this->Apply(mpd, links.at(i), update))
+                failed.push_back(links.at(i).element);
+    }
+}
+void    XLinkResolver::Collect          (MPD *mpd, bool isOnLoadOnly, std::vector<Link> &links)
+{
+    /* the content of an element that is replaced as a whole is not looked into */
+    const std::vector<IPeriod *>& periods = mpd->GetPeriods();
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        Period *period = (Period *) periods.at(i);
+
+        if (XLinkResolver::IsLink(period->GetXlinkHref(), period->GetXlinkActuate(), isOnLoadOnly))
+        {
+            XLinkResolver::AddLink(links, PeriodLink, period, period->GetXlinkHref(), period, NULL, NULL, NULL);
+            continue;
+        }
+
+        SegmentList *segmentList = (SegmentList *) period->GetSegmentList();
+
+        if (segmentList && XLinkResolver::IsLink(segmentList->GetXlinkHref(), segmentList->GetXlinkActuate(), isOnLoadOnly))
+            XLinkResolver::AddLink(links, SegmentListLink, segmentList, segmentList->GetXlinkHref(), period, NULL, NULL, segmentList);
+
+        const std::vector<IAdaptationSet *>& adaptationSets = period->GetAdaptationSets();
+
+        for (size_t j = 0; j < adaptationSets.size(); j++)
+        {
+            AdaptationSet *adaptationSet = (AdaptationSet *) adaptationSets.at(j);
+
+            if (XLinkResolver::IsLink(adaptationSet->GetXlinkHref(), adaptationSet->GetXlinkActuate(), isOnLoadOnly))
+            {
+                XLinkResolver::AddLink(links, AdaptationSetLink, adaptationSet, adaptationSet->GetXlinkHref(), period, adaptationSet, NULL, NULL);
+                continue;
+            }
+
+            segmentList = (SegmentList *) adaptationSet->GetSegmentList();
+
+            if (segmentList && XLinkResolver::IsLink(segmentList->GetXlinkHref(), segmentList->GetXlinkActuate(), isOnLoadOnly))
+                XLinkResolver::AddLink(links, SegmentListLink, segmentList, segmentList->GetXlinkHref(), period, adaptationSet, NULL, segmentList);
+
+            const std::vector<IRepresentation *>& representations = adaptationSet->GetRepresentation();
+
+            for (size_t k = 0; k < representations.size(); k++)
+            {
+                Representation *representation = (Representation *) representations.at(k);
+
+                segmentList = (SegmentList *) representation->GetSegmentList();
+
+                if (segmentList && XLinkResolver::IsLink(segmentList->GetXlinkHref(), segmentList->GetXlinkActuate(), isOnLoadOnly))
+                    XLinkResolver::AddLink(links, SegmentListLink, segmentList, segmentList->GetXlinkHref(), period, adaptationSet, representation, segmentList);
+            }
+        }
+    }
+}
+bool    XLinkResolver::IsLink           (const std::string &href, const std::string &actuate, bool isOnLoadOnly)
+{
+    /* xlink:actuate defaults to onRequest */
+    return !href.empty() && (!isOnLoadOnly || actuate == "onLoad");
+}
+void    XLinkResolver::AddLink          (std::vector<Link> &links, LinkType type, IMPDElement *element, const std::string &href,
+                                         Period *period, AdaptationSet *adaptationSet, Representation *representation, SegmentList *segmentList)
+{
+    Link link;
+    link.type           = type;
+    link.element        = element;
+    link.period         = period;
+    link.adaptationSet  = adaptationSet;
+    link.representation = representation;
+    link.segmentList    = segmentList;
+    link.href           = href;
+    link.isFetched      = false;
+
+    links.push_back(link);
+}
+void    XLinkResolver::Fetch            (MPD *mpd, std::vector<Link> &links)
+{
+    /* references are resolved against the location of the MPD, not its BaseURLs */
+    dash::helpers::Url          base(mpd->GetMPDPathBaseUrl() ? mpd->GetMPDPathBaseUrl()->GetUrl() : "");
+    std::vector<std::string>    downloads;
+
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        Link& link = links.at(i);
+
+        if (link.href == XLinkResolver::ResolveToZero)
+        {
+            link.isFetched = true;
+            continue;
+        }
+
+        link.url = base.Resolve(link.href).ToString();
+
+        if (this->FindDocument(link.url, link.document))
+        {
+            link.isFetched = true;
+            continue;
+        }
+
+        if (std::find(downloads.begin(), downloads.end(), link.url) == downloads.end())
+            downloads.push_back(link.url);
+    }
+
+    if (!downloads.empty())
+    {
+        if (this->connection != NULL)
+            this->FetchThroughConnection(downloads);
+        else
+            this->FetchThroughCurl(downloads);
+    }
+
+    for (size_t i = 0; i < links.size(); i++)
+        if (!links.at(i).isFetched)
+            links.at(i).isFetched = this->FindDocument(links.at(i).url, links.at(i).document);
+}
+void    XLinkResolver::FetchThroughConnection   (const std::vector<std::string> &urls)
+{
+    /* every download runs on a thread of its own, so they are all under way before the first is read */
+    std::vector<Segment *> segments;
+
+    for (size_t i = 0; i < urls.size(); i++)
+    {
+        Segment *segment = new Segment();
+
+        if (!segment->Init(dash::helpers::Url(), urls.at(i), "", dash::metrics::XLinkEpansion) || !segment->StartDownload(this->connection))
+        {
+            delete segment;
+            segment = NULL;
+        }
+
+        segments.push_back(segment);
+    }
+
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        if (segments.at(i) == NULL)
+            continue;
+
+        std::string document;
+        uint8_t     block[32768];
+        int         ret = 0;
+
+        while ((ret = segments.at(i)->Read(block, sizeof(block))) > 0)
+            document.append((const char *) block, ret);
+
+        if (!document.empty())
+            this->AddDocument(urls.at(i), document);
+
+        delete segments.at(i);
+    }
+}
+void    XLinkResolver::FetchThroughCurl         (const std::vector<std::string> &urls)
+{
+    /* one multi handle drives all downloads on the calling thread, libcurl is expected to be initialized by the application */
+    CURLM *multi = curl_multi_init();
+
+    if (multi == NULL)
+        return;
+
+    std::vector<CURL *>         handles(urls.size(), (CURL *) NULL);
+    std::vector<std::string>    documents(urls.size());
+
+    for (size_t i = 0; i < urls.size(); i++)
+    {
+        CURL *curl = curl_easy_init();
+
+        if (curl == NULL)
+            continue;
+
+        curl_easy_setopt(curl, CURLOPT_URL,               urls.at(i).c_str());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION,     CurlWriteCallback);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA,         (void *) &documents.at(i));
+        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION,    1L);
+        curl_easy_setopt(curl, CURLOPT_FAILONERROR,       1L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL,          1L);
+        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, XLinkResolver::ConnectTimeout);
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS,        XLinkResolver::FetchTimeout);
+
+        curl_multi_add_handle(multi, curl);
+        handles.at(i) = curl;
+    }
+
+    int running = 0;
+
+    do
+    {
+        if (curl_multi_perform(multi, &running) != CURLM_OK)
+            break;
+
+        if (running > 0)
+            curl_multi_wait(multi, NULL, 0, 1000, NULL);
+    } while (running > 0);
+
+    int         queued  = 0;
+    CURLMsg     *msg    = NULL;
+
+    while ((msg = curl_multi_info_read(multi, &queued)) != NULL)
+    {
+        if (msg->msg != CURLMSG_DONE || msg->data.result != CURLE_OK)
+            continue;
+
+        for (size_t i = 0; i < handles.size(); i++)
+            if (handles.at(i) == msg->easy_handle && !documents.at(i).empty())
+                this->AddDocument(urls.at(i), documents.at(i));
+    }
+
+    for (size_t i = 0; i < handles.size(); i++)
+    {
+        if (handles.at(i) == NULL)
+            continue;
+
+        curl_multi_remove_handle(multi, handles.at(i));
+        curl_easy_cleanup(handles.at(i));
+    }
+
+    curl_multi_cleanup(multi);
+}
+size_t  XLinkResolver::CurlWriteCallback        (void *contents, size_t size, size_t nmemb, void *userp)
+{
+    std::string *document = (std::string *) userp;
+
+    document->append((const char *) contents, size * nmemb);
+
+    return size * nmemb;
+}
+bool    XLinkResolver::Apply            (MPD *mpd, Link &link, MPDUpdate &update)
+{
+    if (!link.isFetched)
+        return false;
+
+    /* a remote entity may hold any number of elements, so it is parsed wrapped into a single root */
+    std::string document;
+
+    if (link.href != XLinkResolver::ResolveToZero)
+    {
+        size_t begin = 0;
+
+        if (link.document.compare(0, 5, "<?xml") == 0)
+        {
+            begin = link.document.find("?>");
+            begin = (begin == std::string::npos) ? 0 : begin + 2;
+        }
+
+        document = "<XLink xmlns:xlink=\"http://www.w3.org/1999/xlink\">" + link.document.substr(begin) + "</XLink>";
+    }
+
+    DOMParser           parser(link.url, document.c_str(), document.size());
+    std::vector<Node *> nodes;
+
+    if (!document.empty())
+    {
+        if (!parser.Parse())
+            return false;
+
+        nodes = parser.GetRootNode()->GetSubNodes();
+    }
+
+    switch (link.type)
+    {
+        case PeriodLink:
+        {
+            std::vector<Period *> periods;
+
+            for (size_t i = 0; i < nodes.size(); i++)
+                if (nodes.at(i)->GetName() == "Period")
+                    periods.push_back(nodes.at(i)->ToPeriod());
+
+            mpd->ReplacePeriod(link.period, periods);
+            update.Remove(link.period);
+
+            for (size_t i = 0; i < periods.size(); i++)
+                update.Add(periods.at(i));
+
+            return true;
+        }
+        case AdaptationSetLink:
+        {
+            std::vector<AdaptationSet *> adaptationSets;
+
+            for (size_t i = 0; i < nodes.size(); i++)
+                if (nodes.at(i)->GetName() == "AdaptationSet")
+                    adaptationSets.push_back(nodes.at(i)->ToAdaptationSet());
+
+            link.period->ReplaceAdaptationSet(link.adaptationSet, adaptationSets);
+            update.Remove(link.adaptationSet);
+
+            for (size_t i = 0; i < adaptationSets.size(); i++)
+                update.Add(adaptationSets.at(i));
+
+            return true;
+        }
+        case SegmentListLink:
+        {
+            /* a segment list is replaced by a single one, further ones are ignored */
+            SegmentList *segmentList = NULL;
+
+            for (size_t i = 0; i < nodes.size() && segmentList == NULL; i++)
+                if (nodes.at(i)->GetName() == "SegmentList")
+                    segmentList = nodes.at(i)->ToSegmentList();
+
+            if (link.representation)
+                link.representation->SetSegmentList(segmentList);
+            else if (link.adaptationSet)
+                link.adaptationSet->SetSegmentList(segmentList);
+            else
+                link.period->SetSegmentList(segmentList);
+
+            update.Retire(link.segmentList);
+            return true;
+        }
+    }
+
+    return false;
+}
+bool    XLinkResolver::FindDocument     (const std::string &url, std::string &document)
+{
+    EnterCriticalSection(&this->mutex);
+
+    std::map<std::string, std::string>::iterator it = this->documents.find(url);
+    bool isFound = it != this->documents.end();
+
+    if (isFound)
+        document = it->second;
+
+    LeaveCriticalSection(&this->mutex);
+
+    return isFound;
+}
+void    XLinkResolver::AddDocument      (const std::string &url, const std::string &document)
+{
+    EnterCriticalSection(&this->mutex);
+
+    /* the oldest document makes room for a new one */
+    if (this->documents.find(url) == this->documents.end())
+    {
+        this->urls.push_back(url);
+
+        if (this->urls.size() > XLinkResolver::MaxDocuments)
+        {
+            this->documents.erase(this->urls.front());
+            this->urls.pop_front();
+        }
+    }
+
+    this->documents[url] = document;
+
+    LeaveCriticalSection(&this->mutex);
+}
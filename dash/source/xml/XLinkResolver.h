@@ -0,0 +1,95 @@
+/*
+ * XLinkResolver.h
+ *****************************************************************************
+ * Copyright (C) 2013, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef XLINKRESOLVER_H_
+#define XLINKRESOLVER_H_
+
+#include "config.h"
+
+#include "DOMParser.h"
+#include "../mpd/MPD.h"
+#include "../mpd/MPDUpdate.h"
+#include "../mpd/Segment.h"
+#include "../helpers/Url.h"
+#include "../portable/MultiThreading.h"
+#include "IConnection.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         * replaces Period, AdaptationSet and SegmentList elements carrying an xlink:href by the remote elements it refers to,
+         * see ISO/IEC 23009-1, section 5.5. all references of a round are fetched concurrently, the documents are kept by their url.
+         * they are fetched through the connection the application set, or else by libcurl on the calling thread within a bounded time.
+         */
+        class XLinkResolver
+        {
+            public:
+                XLinkResolver           ();
+                virtual ~XLinkResolver  ();
+
+                void    ResolveOnLoad   (dash::mpd::MPD *mpd);
+                bool    Resolve         (dash::mpd::MPD *mpd, const dash::mpd::IMPDElement *element, dash::mpd::MPDUpdate &update);
+                void    SetConnection   (dash::network::IConnection *connection);
+
+            private:
+                enum LinkType
+                {
+                    PeriodLink,
+                    AdaptationSetLink,
+                    SegmentListLink
+                };
+
+                /* an element to be replaced, with the elements containing it */
+                struct Link
+                {
+                    LinkType                    type;
+                    dash::mpd::IMPDElement      *element;
+                    dash::mpd::Period           *period;
+                    dash::mpd::AdaptationSet    *adaptationSet;
+                    dash::mpd::Representation   *representation;
+                    dash::mpd::SegmentList      *segmentList;
+                    std::string                 href;
+                    std::string                 url;
+                    std::string                 document;
+                    bool                        isFetched;
+                };
+
+                static const size_t     MaxRounds;
+                static const size_t     MaxDocuments;
+                static const long       ConnectTimeout;
+                static const long       FetchTimeout;
+                static const char       *ResolveToZero;
+
+                static void     Collect         (dash::mpd::MPD *mpd, bool isOnLoadOnly, std::vector<Link> &links);
+                static bool     IsLink          (const std::string &href, const std::string &actuate, bool isOnLoadOnly);
+                static void     AddLink         (std::vector<Link> &links, LinkType type, dash::mpd::IMPDElement *element, const std::string &href,
+                                                 dash::mpd::Period *period, dash::mpd::AdaptationSet *adaptationSet, dash::mpd::Representation *representation,
+                                                 dash::mpd::SegmentList *segmentList);
+                void            ResolveOnLoad   (dash::mpd::MPD *mpd, dash::mpd::MPDUpdate &update);
+                void            Fetch           (dash::mpd::MPD *mpd, std::vector<Link> &links);
+                void            FetchThroughConnection  (const std::vector<std::string> &urls);
+                void            FetchThroughCurl        (const std::vector<std::string> &urls);
+                static size_t   CurlWriteCallback       (void *contents, size_t size, size_t nmemb, void *userp);
+                bool            Apply           (dash::mpd::MPD *mpd, Link &link, dash::mpd::MPDUpdate &update);
+                bool            FindDocument    (const std::string &url, std::string &document);
+                void            AddDocument     (const std::string &url, const std::string &document);
+
+                dash::network::IConnection          *connection;
+                CRITICAL_SECTION                    mutex;
+                std::map<std::string, std::string>  documents;
+                std::deque<std::string>             urls;
+        };
+    }
+}
+
+#endif /* XLINKRESOLVER_H_ */
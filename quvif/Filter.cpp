@@ -95,13 +95,41 @@ STDMETHODIMP CQuviSourceFilter::Load(LPCOLESTR pszFileName, const AM_MEDIA_TYPE*
 		return url.compare(0, http.size(), http) || url.compare(0, https.size(), https);
 	};
 
+	// the user may pin a quvi format instead of letting us pick one
+	auto getFormatOverride = []() -> std::wstring {
+		WCHAR format[256];
+		DWORD size = sizeof(format);
+		if (RegGetValueW(HKEY_CURRENT_USER, L"Software\\quvif", L"Format", RRF_RT_REG_SZ, nullptr, format, &size) != ERROR_SUCCESS)
+			return std::wstring();
+		return format;
+	};
+
+	auto getSegmentsInFlight = []() -> size_t {
+		DWORD segments = 0;
+		DWORD size = sizeof(segments);
+		if (RegGetValueW(HKEY_CURRENT_USER, L"Software\\quvif", L"SegmentsInFlight", RRF_RT_REG_DWORD, nullptr, &segments, &size) != ERROR_SUCCESS)
+			return 0;
+		return segments;
+	};
+
+	auto getAdaptation = []() -> QuviAdaptation {
+		WCHAR adaptation[256];
+		DWORD size = sizeof(adaptation);
+		if (RegGetValueW(HKEY_CURRENT_USER, L"Software\\quvif", L"Adaptation", RRF_RT_REG_SZ, nullptr, adaptation, &size) == ERROR_SUCCESS &&
+			!_wcsicmp(adaptation, L"buffer"))
+		{
+			return QuviAdaptation::Buffer;
+		}
+		return QuviAdaptation::Throughput;
+	};
+
 	std::wstring url(pszFileName);
 	DbgLog((LOG_TRACE, 2, L"trying to open %s", pszFileName));
 	// do a basic url check first
 	if (doBasicUrlCheck(url)) {
 		try {
 			// then try to init quvi
-			m_pQuvi = std::make_unique<QuviMedia>(std::move(url));
+			m_pQuvi = std::make_unique<QuviMedia>(std::move(url), getFormatOverride(), getSegmentsInFlight(), getAdaptation());
 		} catch (QUVIcode qc) {
 			(qc); // silence unused variable warning in release builds
 			DbgLog((LOG_TRACE, 1, L"opening %s failed, quvi code: %d", pszFileName, (int)qc));
@@ -81,13 +81,12 @@ STDMETHODIMP CQuviOutputPin::Length(LONGLONG* pTotal, LONGLONG* pAvailable) {
 	CheckPointer(pAvailable, E_POINTER);
 
 	// TODO: handle zero length correctly
-	// TODO: do something more smart to actual length
-	// TODO: support untrustworthy file lengths
 	const auto& backend = m_pFilter->m_pQuvi->GetBackends()[m_index];
+	const bool bExact = backend->IsTotalLengthExact();
 	*pTotal = backend->GetTotalLength();
 	*pAvailable = backend->GetCurrentLength();
 
-	return S_OK;
+	return bExact ? S_OK : VFW_S_ESTIMATED;
 }
 
 STDMETHODIMP CQuviOutputPin::Request(IMediaSample* pSample, DWORD_PTR dwUser) {
@@ -105,9 +104,20 @@ STDMETHODIMP CQuviOutputPin::SyncRead(LONGLONG llPosition, LONG lLength, BYTE* p
 
 	const auto& backend = m_pFilter->m_pQuvi->GetBackends()[m_index];
 
+	if (llPosition < 0 || lLength <= 0)
+		return E_INVALIDARG;
+
+	// the backend knows where a stream of estimated length ends, by then the length is exact
+	if (!backend->IsTotalLengthExact()) {
+		if (backend->Get((uint64_t)llPosition, (size_t)lLength, (char*)pBuffer))
+			return S_OK;
+		if (!backend->IsTotalLengthExact())
+			return E_FAIL;
+	}
+
 	const uint64_t filelen = backend->GetTotalLength();
 
-	if (llPosition < 0 || (uint64_t)llPosition >= filelen || lLength <= 0)
+	if ((uint64_t)llPosition >= filelen)
 		return E_INVALIDARG;
 
 	HRESULT ret = S_OK;
@@ -35,9 +35,6 @@ std::string MultibyteFromWide(const wchar_t* src) {
 
 QuviMediaInfo::Quvi::Quvi() {
 	QUVIcode qc = quvi_init(&q);
-	if (qc != QUVI_OK)
-		throw qc;
-	qc = quvi_setopt(q, QUVIOPT_FORMAT, "best");
 	if (qc != QUVI_OK)
 		throw qc;
 	qc = quvi_setopt(q, QUVIOPT_CATEGORY, QUVIPROTO_HTTP);
@@ -45,28 +42,197 @@ QuviMediaInfo::Quvi::Quvi() {
 		throw qc;
 }
 
-QuviMediaInfo::QuviParse::QuviParse(Quvi& q, const std::wstring& url) {
+QuviMediaInfo::QuviParse::QuviParse(Quvi& q, const std::wstring& url, const std::string& format) {
+	QUVIcode qc = quvi_setopt(q, QUVIOPT_FORMAT, format.c_str());
+	if (qc != QUVI_OK)
+		throw qc;
 	std::string murl(MultibyteFromWide(url.c_str()));
-	QUVIcode qc = quvi_parse(q, murl.empty() ? "" : &murl[0], &qm);
+	qc = quvi_parse(q, murl.empty() ? "" : &murl[0], &qm);
 	if (qc != QUVI_OK)
 		throw qc;
 }
 
-QuviMediaInfo::QuviMediaInfo(std::wstring&& url)
+namespace {
+	size_t CurlDiscardCallback(char* ptr, size_t size, size_t nmemb, void* userdata) {
+		UNREFERENCED_PARAMETER(ptr);
+		UNREFERENCED_PARAMETER(userdata);
+		return size * nmemb;
+	}
+
+	// downloads the beginning of the url and returns observed throughput in bits per second, zero if unknown
+	uint64_t MeasureThroughput(CURL* curl, const std::string& url) {
+		static const char* SampleRange = "0-524287";
+		static const long SampleTimeout = 4000; // ms
+
+		CURL* sample = curl_easy_duphandle(curl);
+		if (!sample)
+			return 0;
+
+		curl_easy_setopt(sample, CURLOPT_URL, url.c_str());
+		curl_easy_setopt(sample, CURLOPT_HTTPGET, 1L);
+		curl_easy_setopt(sample, CURLOPT_RANGE, SampleRange);
+		curl_easy_setopt(sample, CURLOPT_TIMEOUT_MS, SampleTimeout);
+		curl_easy_setopt(sample, CURLOPT_WRITEFUNCTION, CurlDiscardCallback);
+		curl_easy_setopt(sample, CURLOPT_WRITEDATA, nullptr);
+
+		// running out of time is fine, the sample is still representative
+		const CURLcode cc = curl_easy_perform(sample);
+
+		double bytes = 0, total = 0, start = 0;
+		if (cc == CURLE_OK || cc == CURLE_OPERATION_TIMEDOUT) {
+			curl_easy_getinfo(sample, CURLINFO_SIZE_DOWNLOAD, &bytes);
+			curl_easy_getinfo(sample, CURLINFO_TOTAL_TIME, &total);
+			curl_easy_getinfo(sample, CURLINFO_STARTTRANSFER_TIME, &start);
+		}
+		curl_easy_cleanup(sample);
+
+		// don't count connection setup and server think time
+		const double seconds = total - start;
+		if (bytes <= 0 || seconds <= 0)
+			return 0;
+
+		return (uint64_t)(bytes * 8 / seconds);
+	}
+
+	// a handle may only be used by one thread at a time, duplicating one reads it too,
+	// so the handles for other threads are made up front by the thread owning the original
+	std::shared_ptr<CURL> DuplicateCurl(CURL* curl) {
+		CURL* duplicate = curl_easy_duphandle(curl);
+		if (!duplicate)
+			return nullptr;
+		return std::shared_ptr<CURL>(duplicate, curl_easy_cleanup);
+	}
+}
+
+std::string QuviMediaInfo::SelectFormat(Quvi& q, const std::wstring& url, const std::wstring& format, std::unique_ptr<QuviParse>& parse) {
+	static const char* FallbackFormat = "best";
+	static const size_t MaxProbedFormats = 4; // each probe is a full page parse
+
+	// honor the override
+	if (!format.empty())
+		return MultibyteFromWide(format.c_str());
+
+	char* formats = nullptr;
+	std::string murl(MultibyteFromWide(url.c_str()));
+	QUVIcode qc = quvi_query_formats(q, murl.empty() ? "" : &murl[0], &formats);
+	if (qc != QUVI_OK || !formats)
+		return FallbackFormat;
+
+	std::vector<std::string> ids;
+	{
+		std::istringstream stream(formats);
+		for (std::string id; std::getline(stream, id, '|');) {
+			if (!id.empty() && id != "default" && id != FallbackFormat)
+				ids.emplace_back(std::move(id));
+		}
+	}
+	quvi_free(formats);
+
+	if (ids.size() < 2)
+		return FallbackFormat;
+
+	struct Candidate {
+		std::string format;
+		std::string url;
+		uint64_t bitrate; // bits per second
+		std::unique_ptr<QuviParse> parse; // kept for whichever candidate gets picked
+	};
+	std::vector<Candidate> candidates;
+
+	// estimate bitrate of a format from its length and duration
+	auto probe = [&](const std::string& id) {
+		try {
+			std::unique_ptr<QuviParse> qp(new QuviParse(q, url, id));
+
+			char* mediaUrl = nullptr;
+			double length = 0, duration = 0;
+			if (quvi_getprop(*qp, QUVIPROP_MEDIAURL, &mediaUrl) != QUVI_OK || !mediaUrl ||
+				quvi_getprop(*qp, QUVIPROP_MEDIACONTENTLENGTH, &length) != QUVI_OK || length <= 0 ||
+				quvi_getprop(*qp, QUVIPROP_MEDIADURATION, &duration) != QUVI_OK || duration <= 0)
+			{
+				return false;
+			}
+
+			// duration is in milliseconds
+			candidates.push_back({ id, mediaUrl, (uint64_t)(length * 8 * 1000 / duration), std::move(qp) });
+			return true;
+		} catch (QUVIcode) {
+			// skip formats quvi can't deliver
+			return false;
+		}
+	};
+
+	auto pick = [&parse](Candidate& candidate) {
+		parse = std::move(candidate.parse);
+		return std::move(candidate.format);
+	};
+
+	CURL* curl = nullptr;
+	qc = quvi_getinfo(q, QUVIINFO_CURL, &curl);
+	if (qc != QUVI_OK)
+		curl = nullptr;
+
+	// leave a quarter of the link for bitrate peaks and other traffic
+	uint64_t throughput = 0;
+	auto fits = [&throughput](const Candidate& candidate) {
+		return candidate.bitrate <= throughput / 4 * 3;
+	};
+
+	// the best format is probed first, when the link sustains it there's nothing to choose
+	if (probe(FallbackFormat)) {
+		if (!curl)
+			return pick(candidates.front());
+		throughput = MeasureThroughput(curl, candidates.front().url);
+		if (!throughput || fits(candidates.front()))
+			return pick(candidates.front());
+	}
+
+	// quvi can only tell a format's bitrate by parsing the page for it, and the list isn't ordered by quality,
+	// so probe a spread of it that always takes in both ends
+	const size_t probes = std::min(ids.size(), MaxProbedFormats);
+	for (size_t i = 0; i < probes; i++)
+		probe(ids[i * (ids.size() - 1) / (probes - 1)]);
+
+	if (candidates.empty())
+		return FallbackFormat;
+
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+		return a.bitrate > b.bitrate;
+	});
+
+	// sample from the highest bitrate candidate, its server is the one most likely to be used
+	if (!throughput && curl)
+		throughput = MeasureThroughput(curl, candidates.front().url);
+	if (!throughput)
+		return pick(candidates.front());
+
+	for (auto& candidate : candidates) {
+		if (fits(candidate))
+			return pick(candidate);
+	}
+
+	// nothing fits, the lowest bitrate rebuffers the least
+	return pick(candidates.back());
+}
+
+QuviMediaInfo::QuviMediaInfo(std::wstring&& url, const std::wstring& format)
 	: m_ourl(std::move(url))
-	, m_qp(m_q, m_ourl)
 {
+	m_format = SelectFormat(m_q, m_ourl, format, m_qp);
+	if (!m_qp)
+		m_qp.reset(new QuviParse(m_q, m_ourl, m_format));
+
 	QUVIcode qc;
 
 	char* infoUrl = nullptr;
-	qc = quvi_getprop(m_qp, QUVIPROP_MEDIAURL, &infoUrl);
+	qc = quvi_getprop(*m_qp, QUVIPROP_MEDIAURL, &infoUrl);
 	if (qc != QUVI_OK || !infoUrl)
 		throw qc;
 	m_url = WideFromMultibyte(infoUrl);
 	m_murl = infoUrl;
 
 	char* infoTitle = nullptr;
-	qc = quvi_getprop(m_qp, QUVIPROP_PAGETITLE, &infoTitle);
+	qc = quvi_getprop(*m_qp, QUVIPROP_PAGETITLE, &infoTitle);
 	if (qc == QUVI_OK && infoTitle) {
 		// not nice to expect the page to be encoded in utf-8, but quvi doesn't leave much choice
 		std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
@@ -74,12 +240,12 @@ QuviMediaInfo::QuviMediaInfo(std::wstring&& url)
 	}
 
 	char* infoContentType = nullptr;
-	qc = quvi_getprop(m_qp, QUVIPROP_MEDIACONTENTTYPE, &infoContentType);
+	qc = quvi_getprop(*m_qp, QUVIPROP_MEDIACONTENTTYPE, &infoContentType);
 	if (qc == QUVI_OK && infoContentType)
 		m_contentType = infoContentType;
 
 	double len = 0;
-	qc = quvi_getprop(m_qp, QUVIPROP_MEDIACONTENTLENGTH, &len);
+	qc = quvi_getprop(*m_qp, QUVIPROP_MEDIACONTENTLENGTH, &len);
 	if (qc == QUVI_OK && len > 0)
 		m_contentLength = (uint64_t)len;
 
@@ -261,13 +427,15 @@ class QuviSimpleStreamBackend final : public QuviMediaBackend {
 	}
 
 public:
-	QuviSimpleStreamBackend(uint64_t length, CURL* curl, CURLSH* curlsh)
+	QuviSimpleStreamBackend(const std::string& url, uint64_t length, CURL* curl, CURLSH* curlsh)
 		: m_length(length)
 		, m_curl(curl_easy_duphandle(curl))
 	{
 		assert(m_curl); // TODO: throw exception
 		assert(curlsh); // TODO: throw exception
 		curl_easy_setopt(m_curl, CURLOPT_SHARE, curlsh);
+		curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
+		curl_easy_setopt(m_curl, CURLOPT_HTTPGET, 1L);
 
 		size_t packets = (size_t)(m_length / CachePacketSize); // full
 		if (m_length - packets * CachePacketSize) // eof stub
@@ -331,126 +499,1593 @@ public:
 	}
 };
 
-void QuviMedia::CurlShareLockFunction(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr) {
+struct QuviSegment {
+	std::string url;
+	// inclusive byte range inside the url, the whole resource if not ranged
+	bool ranged = false;
+	uint64_t first = 0;
+	uint64_t last = 0;
+};
+
+// one encoding of a stream, the segments of all encodings given to a backend must be aligned
+struct QuviSegmentedRepresentation {
+	uint64_t bandwidth = 0; // bits per second
+	bool bInitialization = false; // first segment sets up the decoder
+	std::vector<QuviSegment> segments;
+};
+
+// decides which encoding the next segment is downloaded in
+class QuviAdaptationPolicy {
+public:
+	struct State {
+		uint64_t throughput; // bits per second, zero if unknown
+		size_t buffered; // segments downloaded ahead of the reader
+		size_t capacity; // segments that may be downloaded ahead of the reader
+		size_t current; // representation
+	};
+	virtual ~QuviAdaptationPolicy() {}
+	// representations are sorted by bandwidth, lowest first
+	virtual size_t Choose(const std::vector<QuviSegmentedRepresentation>& representations, const State& state) = 0;
+};
+
+// the highest bandwidth the measured throughput sustains
+class QuviThroughputPolicy final : public QuviAdaptationPolicy {
+public:
+	virtual size_t Choose(const std::vector<QuviSegmentedRepresentation>& representations, const State& state) override {
+		if (!state.throughput)
+			return state.current;
+
+		// leave a quarter of the link for bitrate peaks and other traffic
+		const uint64_t sustainable = state.throughput / 4 * 3;
+		size_t choice = 0;
+		for (size_t i = 0; i < representations.size(); i++) {
+			if (representations[i].bandwidth <= sustainable)
+				choice = i;
+		}
+		return choice;
+	}
+};
+
+// bola: trades the quality of the next segment against the risk of draining the buffer
+class QuviBufferPolicy final : public QuviAdaptationPolicy {
+	static const double Gamma; // rebuffering penalty, in utility per segment
+public:
+	virtual size_t Choose(const std::vector<QuviSegmentedRepresentation>& representations, const State& state) override {
+		assert(!representations.empty());
+		const double lowest = (double)std::max<uint64_t>(representations.front().bandwidth, 1);
+		auto utility = [&](size_t i) { return std::log(std::max<uint64_t>(representations[i].bandwidth, 1) / lowest); };
+
+		// full buffer is worth the highest quality
+		const double v = (std::max<size_t>(state.capacity, 2) - 1) / (utility(representations.size() - 1) + Gamma);
+
+		size_t choice = 0;
+		double best = -DBL_MAX;
+		for (size_t i = 0; i < representations.size(); i++) {
+			const double score = (v * (utility(i) + Gamma) - state.buffered) / std::max<uint64_t>(representations[i].bandwidth, 1);
+			if (score > best) {
+				best = score;
+				choice = i;
+			}
+		}
+		return choice;
+	}
+};
+
+const double QuviBufferPolicy::Gamma = 5;
+
+// downloads a sequence of segments a few at a time ahead of the reader and presents them as one stream,
+// switching between encodings at segment boundaries when there's more than one,
+// when every segment is a byte range of the only encoding the layout is known up front and the reader can jump anywhere,
+// live streams keep getting segments appended until they're finished
+class QuviSegmentedBackend final : public QuviMediaBackend {
+	static const size_t DefaultSegmentsInFlight = 3;
+	// how many segments past the one being read may be downloaded
+	static const size_t FetchAhead = 8;
+	// how many segments behind the one being read a live stream keeps around
+	static const size_t KeepBehind = 16;
+	// a segment still failing after these is skipped
+	static const int FetchAttempts = 3;
+	// weight of the newest throughput sample
+	static const double ThroughputSmoothing;
+	static const size_t Undecided = SIZE_MAX;
+
+	typedef std::vector<char> Buffer;
+
+	std::vector<QuviSegmentedRepresentation> m_representations;
+	std::vector<size_t> m_order; // of the representations as given
+	const std::unique_ptr<QuviAdaptationPolicy> m_policy;
+	const bool m_bReinitialize; // switching requires the initialization segment of the new encoding
+	size_t m_count; // segments
+	bool m_bLive;
+	const size_t m_segmentsInFlight; // transfers running at the same time
+	CURLSH* m_curlsh;
+
+	bool m_bExact = false;
+	uint64_t m_exactLength = 0; // bytes
+
+	std::vector<std::shared_ptr<const Buffer>> m_cache;
+	std::vector<bool> m_fetching;
+	std::vector<size_t> m_choices; // representation of each segment
+	std::vector<uint64_t> m_starts; // of every segment if exact, of the contiguous downloaded ones otherwise
+	size_t m_contiguous = 0; // segments
+	uint64_t m_contiguousLength = 0; // bytes
+	size_t m_fetched = 0; // segments
+	uint64_t m_fetchedLength = 0; // bytes
+	size_t m_reading = 0; // segment
+	double m_throughput = 0; // bits per second
+	bool m_bFailed = false;
+
+	std::vector<std::thread> m_workers;
+	std::mutex m_workerMutex;
+	std::condition_variable m_workerCondition;
+
+	std::atomic<bool> m_bDestroying;
+
+	struct CurlCallbackData {
+		QuviSegmentedBackend* owner;
+		Buffer* buffer;
+	};
+	static size_t CurlCallback(char* ptr, size_t size, size_t nmemb, void* userdata) {
+		auto& data = *static_cast<CurlCallbackData*>(userdata);
+		const size_t gotnow = size * nmemb;
+
+		// abort if the filter is being destroyed
+		if (data.owner->m_bDestroying)
+			return gotnow + 1;
+
+		data.buffer->insert(data.buffer->end(), ptr, ptr + gotnow);
+		return gotnow;
+	}
+
+	bool Fetch(CURL* curl, const QuviSegment& segment, Buffer& dest) {
+		const std::string range = segment.ranged ? std::to_string(segment.first) + "-" + std::to_string(segment.last) : "";
+		curl_easy_setopt(curl, CURLOPT_URL, segment.url.c_str());
+		curl_easy_setopt(curl, CURLOPT_RANGE, segment.ranged ? range.c_str() : nullptr);
+
+		for (int attempt = 0; attempt < FetchAttempts && !m_bDestroying; attempt++) {
+			// give a struggling server a little longer each time
+			if (attempt > 0) {
+				std::unique_lock<std::mutex> lock(m_workerMutex);
+				m_workerCondition.wait_for(lock, std::chrono::seconds(attempt), [this]() { return (bool)m_bDestroying; });
+				if (m_bDestroying)
+					break;
+			}
+
+			Buffer buffer;
+			if (segment.ranged)
+				buffer.reserve((size_t)(segment.last - segment.first + 1));
+
+			CurlCallbackData data = { this, &buffer };
+			curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
+
+			const CURLcode cc = curl_easy_perform(curl);
+			long code = 0;
+			curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+			if (cc != CURLE_OK || code >= 400)
+				continue;
+
+			// the server may ignore the range and send the whole resource
+			if (segment.ranged && code != 206) {
+				if (segment.last >= buffer.size())
+					continue;
+				buffer.erase(buffer.begin() + (size_t)(segment.last + 1), buffer.end());
+				buffer.erase(buffer.begin(), buffer.begin() + (size_t)segment.first);
+			}
+
+			// offsets past a short range would all be wrong
+			if (segment.ranged && buffer.size() != segment.last - segment.first + 1)
+				continue;
+
+			Measure(curl);
+			dest.insert(dest.end(), buffer.begin(), buffer.end());
+			return true;
+		}
+
+		return false;
+	}
+
+	void Measure(CURL* curl) {
+		double bytes = 0, total = 0, start = 0;
+		curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD, &bytes);
+		curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME, &total);
+		curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME, &start);
+
+		// don't count server think time, and tiny transfers say nothing
+		const double seconds = total - start;
+		if (bytes < 16 * 1024 || seconds <= 0)
+			return;
+
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		const double sample = bytes * 8 / seconds;
+		m_throughput = m_throughput ? m_throughput + (sample - m_throughput) * ThroughputSmoothing : sample;
+	}
+
+	size_t GetWindow() const {
+		return std::max(FetchAhead, m_segmentsInFlight);
+	}
+
+	// picks the encoding, expects the lock to be held
+	size_t Choose(size_t index) {
+		if (m_representations.size() == 1)
+			return 0;
+
+		// continue with whatever came before
+		size_t current = 0;
+		for (size_t i = index; i-- > 0;) {
+			if (m_choices[i] != Undecided) {
+				current = m_choices[i];
+				break;
+			}
+		}
+
+		// the initialization segment goes with the first media segment
+		if (index == 0 && m_bReinitialize)
+			return current;
+
+		QuviAdaptationPolicy::State state;
+		state.throughput = (uint64_t)m_throughput;
+		state.buffered = m_contiguous > m_reading ? m_contiguous - m_reading : 0;
+		state.capacity = GetWindow();
+		state.current = current;
+		const size_t choice = m_policy->Choose(m_representations, state);
+		assert(choice < m_representations.size());
+		return choice;
+	}
+
+	// takes over the handle, null if it couldn't be made
+	void Loop(CURL* curl) {
+		if (curl) {
+			curl_easy_setopt(curl, CURLOPT_SHARE, m_curlsh);
+			curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+			curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlCallback);
+		}
+
+		// first segment inside the window that nobody has taken yet
+		auto pick = [&](size_t& index) -> bool {
+			const size_t end = std::min(m_count, m_reading + GetWindow());
+			for (index = m_reading; index < end; index++) {
+				if (!m_cache[index] && !m_fetching[index])
+					return true;
+			}
+			return false;
+		};
+
+		while (curl) {
+			size_t index;
+			QuviSegment segment, initialization;
+			bool bReinitialize = false;
+			{
+				std::unique_lock<std::mutex> lock(m_workerMutex);
+				m_workerCondition.wait(lock, [&]() { return m_bDestroying || m_bFailed || pick(index); });
+				if (m_bDestroying || m_bFailed)
+					break;
+				m_fetching[index] = true;
+
+				const size_t previous = index > 0 ? m_choices[index - 1] : Undecided;
+				m_choices[index] = Choose(index);
+				bReinitialize = m_bReinitialize && index > 0 && previous != Undecided && previous != m_choices[index];
+
+				// copies, appending may move the segments around
+				const auto& representation = m_representations[m_choices[index]];
+				segment = representation.segments[index];
+				if (bReinitialize)
+					initialization = representation.segments.front();
+			}
+
+			auto buffer = std::make_shared<Buffer>();
+			bool bInitialized = true;
+			// the decoder needs to be set up again after a switch
+			if (bReinitialize)
+				bInitialized = Fetch(curl, initialization, *buffer);
+			const bool bFetched = bInitialized && Fetch(curl, segment, *buffer);
+
+			// a lost media segment is skipped and the stream goes on, but there's nothing to decode without initialization
+			bool bSkipped = false;
+			if (!bFetched && !m_bDestroying && bInitialized && (index > 0 || !m_representations.front().bInitialization)) {
+				bSkipped = true;
+				// the layout of an exact stream is fixed, so the range is kept and left blank
+				if (m_bExact)
+					buffer->assign((size_t)(segment.last - segment.first + 1), 0);
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_workerMutex);
+				m_fetching[index] = false;
+				if (bFetched || bSkipped) {
+					// a skipped segment says nothing about the size of the others
+					if (bFetched) {
+						m_fetched++;
+						m_fetchedLength += buffer->size();
+					}
+					m_cache[index] = std::move(buffer);
+
+					// extend the part of the stream that can be read without gaps
+					while (m_contiguous < m_cache.size() && m_cache[m_contiguous]) {
+						if (!m_bExact)
+							m_starts.push_back(m_contiguousLength);
+						m_contiguousLength += m_cache[m_contiguous]->size();
+						m_contiguous++;
+					}
+				} else if (!m_bDestroying) {
+					m_bFailed = true;
+				}
+			}
+			m_workerCondition.notify_all();
+		}
+
+		if (curl) {
+			curl_easy_setopt(curl, CURLOPT_SHARE, nullptr);
+			curl_easy_cleanup(curl);
+		} else {
+			std::lock_guard<std::mutex> lock(m_workerMutex);
+			m_bFailed = true;
+			m_workerCondition.notify_all();
+		}
+	}
+
+	void Stop() {
+		{
+			// under the lock, so no waiter can miss it between checking and going to sleep
+			std::lock_guard<std::mutex> lock(m_workerMutex);
+			m_bDestroying = true;
+		}
+		m_workerCondition.notify_all();
+		for (auto& worker : m_workers)
+			worker.join();
+	}
+
+public:
+	// zero segments in flight picks the default, the policy is only needed with more than one representation
+	QuviSegmentedBackend(std::vector<QuviSegmentedRepresentation>&& representations, std::unique_ptr<QuviAdaptationPolicy> policy,
+		bool bBitstreamSwitching, bool bLive, size_t segmentsInFlight, CURL* curl, CURLSH* curlsh)
+		: m_representations(std::move(representations))
+		, m_order(m_representations.size())
+		, m_policy(std::move(policy))
+		, m_bReinitialize(!bBitstreamSwitching && !m_representations.empty() && m_representations.front().bInitialization)
+		, m_count(m_representations.empty() ? 0 : m_representations.front().segments.size())
+		, m_bLive(bLive)
+		, m_segmentsInFlight(segmentsInFlight ? segmentsInFlight : DefaultSegmentsInFlight)
+		, m_curlsh(curlsh)
+		, m_cache(m_count)
+		, m_fetching(m_count)
+		, m_choices(m_count, Undecided)
+		, m_bDestroying(false)
+	{
+		assert(curl);
+		assert(m_curlsh);
+		if (!m_count)
+			throw 1; // TODO: replace with some sensible exception
+		if (m_representations.size() > 1 && !m_policy)
+			throw 1; // TODO: replace with some sensible exception
+		for (const auto& representation : m_representations) {
+			if (representation.segments.size() != m_count || representation.bInitialization != m_representations.front().bInitialization)
+				throw 1; // TODO: replace with some sensible exception
+		}
+
+		// policies expect the lowest bandwidth first
+		std::vector<size_t> sorted(m_representations.size());
+		for (size_t i = 0; i < sorted.size(); i++)
+			sorted[i] = i;
+		std::stable_sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+			return m_representations[a].bandwidth < m_representations[b].bandwidth;
+		});
+		std::vector<QuviSegmentedRepresentation> reordered;
+		for (size_t i = 0; i < sorted.size(); i++) {
+			m_order[sorted[i]] = i;
+			reordered.emplace_back(std::move(m_representations[sorted[i]]));
+		}
+		m_representations = std::move(reordered);
+
+		const auto& segments = m_representations.front().segments;
+		m_bExact = !m_bLive && m_representations.size() == 1 && std::all_of(segments.begin(), segments.end(), [](const QuviSegment& segment) {
+			return segment.ranged;
+		});
+		if (m_bExact) {
+			for (const auto& segment : segments) {
+				m_starts.push_back(m_exactLength);
+				m_exactLength += segment.last - segment.first + 1;
+			}
+		}
+
+		// the handles are duplicated before any worker runs, the original stays with the caller
+		std::vector<CURL*> handles;
+		for (size_t i = 0; i < m_segmentsInFlight; i++)
+			handles.push_back(curl_easy_duphandle(curl));
+		for (size_t i = 0; i < m_segmentsInFlight; i++)
+			m_workers.emplace_back(std::bind(&QuviSegmentedBackend::Loop, this, handles[i]));
+
+		// the length estimate is meaningless until something arrives, and the stream is useless without the start
+		bool bFailed;
+		{
+			std::unique_lock<std::mutex> lock(m_workerMutex);
+			m_workerCondition.wait(lock, [&]() { return m_contiguous > 0 || m_bFailed; });
+			bFailed = !m_contiguous;
+		}
+		if (bFailed) {
+			Stop();
+			throw 1; // TODO: replace with some sensible exception
+		}
+	}
+	~QuviSegmentedBackend() {
+		Stop();
+	}
+
+	// continues a live stream, one list of media segments per representation in the order given on construction
+	void Append(std::vector<std::vector<QuviSegment>>&& segments) {
+		assert(segments.size() == m_representations.size());
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		assert(m_bLive);
+
+		// only as far as every representation has got
+		size_t count = SIZE_MAX;
+		for (const auto& appended : segments)
+			count = std::min(count, appended.size());
+		if (!count)
+			return;
+
+		for (size_t i = 0; i < segments.size(); i++) {
+			auto& destination = m_representations[m_order[i]].segments;
+			destination.insert(destination.end(), segments[i].begin(), segments[i].begin() + count);
+		}
+		m_count += count;
+		m_cache.resize(m_count);
+		m_fetching.resize(m_count);
+		m_choices.resize(m_count, Undecided);
+		m_workerCondition.notify_all();
+	}
+
+	// a live stream won't get any more segments
+	void Finish() {
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		m_bLive = false;
+		m_workerCondition.notify_all();
+	}
+
+	virtual bool Get(uint64_t offset, size_t length, char* dest) override {
+		assert(length > 0 && dest);
+		while (length > 0) {
+			std::shared_ptr<const Buffer> buffer;
+			size_t bufferoffset;
+			{
+				std::unique_lock<std::mutex> lock(m_workerMutex);
+
+				size_t index;
+				if (m_bExact) {
+					// go straight to the segment holding the offset
+					if (offset >= m_exactLength)
+						return false;
+					index = std::upper_bound(m_starts.begin(), m_starts.end(), offset) - m_starts.begin() - 1;
+					if (m_reading != index) {
+						m_reading = index;
+						m_workerCondition.notify_all();
+					}
+					m_workerCondition.wait(lock, [&]() { return m_cache[index] || m_bFailed || m_bDestroying; });
+					if (!m_cache[index] || m_bDestroying)
+						return false;
+				} else {
+					// block until everything up to the offset is downloaded
+					while (offset >= m_contiguousLength) {
+						if ((m_contiguous == m_count && !m_bLive) || m_bFailed || m_bDestroying)
+							return false;
+						m_reading = m_contiguous;
+						m_workerCondition.notify_all();
+						m_workerCondition.wait(lock);
+					}
+					index = std::upper_bound(m_starts.begin(), m_starts.end(), offset) - m_starts.begin() - 1;
+					if (m_reading != index) {
+						m_reading = index;
+						m_workerCondition.notify_all();
+					}
+
+					// a live stream would fill the memory up
+					if (m_bLive && index > KeepBehind)
+						m_cache[index - KeepBehind - 1].reset();
+				}
+
+				buffer = m_cache[index];
+				if (!buffer)
+					return false;
+				bufferoffset = (size_t)(offset - m_starts[index]);
+			}
+
+			const size_t tocopy = std::min(length, buffer->size() - bufferoffset);
+			memcpy(dest, buffer->data() + bufferoffset, tocopy);
+
+			offset += tocopy;
+			length -= tocopy;
+			dest += tocopy;
+		}
+
+		return true;
+	}
+
+	virtual uint64_t GetCurrentLength() override {
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		return m_contiguousLength;
+	}
+
+	virtual uint64_t GetTotalLength() override {
+		if (m_bExact)
+			return m_exactLength;
+
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		if (!m_bLive && m_contiguous == m_count)
+			return m_contiguousLength;
+
+		// extrapolate from the average size of what's been downloaded, skipped segments leave nothing to go by
+		if (!m_fetched)
+			return m_contiguousLength;
+		return m_fetchedLength + m_fetchedLength / m_fetched * (m_count - m_fetched);
+	}
+
+	// the extrapolation turns exact once a finished stream has everything downloaded
+	virtual bool IsTotalLengthExact() override {
+		if (m_bExact)
+			return true;
+
+		std::lock_guard<std::mutex> lock(m_workerMutex);
+		return !m_bLive && m_contiguous == m_count;
+	}
+};
+
+const double QuviSegmentedBackend::ThroughputSmoothing = 0.3;
+
+namespace {
+	enum class DashRepresentationType {
+		Base,
+		Template,
+		List,
+	};
+
+	DashRepresentationType DetermineDashType(const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet,
+		const dash::mpd::IRepresentation* representation)
+	{
+		assert(representation && adaptationSet && period);
+		if (representation->GetSegmentList())
+			return DashRepresentationType::List;
+		if (representation->GetSegmentTemplate())
+			return DashRepresentationType::Template;
+		if (representation->GetSegmentBase() || !representation->GetBaseURLs().empty())
+			return DashRepresentationType::Base;
+
+		if (adaptationSet->GetSegmentList())
+			return DashRepresentationType::List;
+		if (adaptationSet->GetSegmentTemplate())
+			return DashRepresentationType::Template;
+		if (adaptationSet->GetSegmentBase())
+			return DashRepresentationType::Base;
+
+		if (period->GetSegmentList())
+			return DashRepresentationType::List;
+		if (period->GetSegmentTemplate())
+			return DashRepresentationType::Template;
+		if (period->GetSegmentBase())
+			return DashRepresentationType::Base;
+
+		throw 1; // TODO: replace with some sensible exception
+	}
+
+	// what an adaptation set is recognized by in another period or revision of the manifest,
+	// held by value, so it stays valid when the model it was taken from is gone
+	struct DashAdaptationSetKey {
+		uint32_t id;
+		std::string contentType; // the mime type if the content type isn't given
+		std::string lang;
+		size_t index; // position within the period
+	};
+
+	DashAdaptationSetKey GetDashAdaptationSetKey(const dash::mpd::IAdaptationSet* adaptationSet, size_t index) {
+		assert(adaptationSet);
+		DashAdaptationSetKey key = { adaptationSet->GetId(), adaptationSet->GetContentType(), adaptationSet->GetLang(), index };
+		if (key.contentType.empty())
+			key.contentType = adaptationSet->GetMimeType();
+		return key;
+	}
+
+	// finds the adaptation set of the period that continues the reference one,
+	// by id first, then by content type and language, then by position
+	const dash::mpd::IAdaptationSet* MatchDashAdaptationSet(const dash::mpd::IPeriod* period, const DashAdaptationSetKey& reference) {
+		assert(period);
+		const auto& adaptationSets = period->GetAdaptationSets();
+
+		if (reference.id) {
+			for (const auto& adaptationSet : adaptationSets) {
+				if (adaptationSet->GetId() == reference.id)
+					return adaptationSet;
+			}
+		}
+
+		if (!reference.contentType.empty()) {
+			for (const auto& adaptationSet : adaptationSets) {
+				const std::string candidateType = adaptationSet->GetContentType().empty() ?
+					adaptationSet->GetMimeType() : adaptationSet->GetContentType();
+				if (candidateType == reference.contentType && adaptationSet->GetLang() == reference.lang)
+					return adaptationSet;
+			}
+		}
+
+		return reference.index < adaptationSets.size() ? adaptationSets[reference.index] : nullptr;
+	}
+
+	// asks for the lengths of all the urls at once, so opening takes as long as the slowest server and not the sum of them
+	std::vector<uint64_t> GetRemoteLengths(CURL* curl, const std::vector<std::string>& urls) {
+		std::unique_ptr<CURLM, decltype(&curl_multi_cleanup)> multi(curl_multi_init(), curl_multi_cleanup);
+		if (!multi)
+			throw 1; // TODO: replace with some sensible exception
+
+		std::vector<std::shared_ptr<CURL>> handles;
+		for (const auto& url : urls) {
+			const std::shared_ptr<CURL> handle = DuplicateCurl(curl);
+			if (!handle)
+				break;
+			curl_easy_setopt(handle.get(), CURLOPT_URL, url.c_str());
+			curl_easy_setopt(handle.get(), CURLOPT_NOBODY, 1L);
+			curl_multi_add_handle(multi.get(), handle.get());
+			handles.push_back(handle);
+		}
+
+		int running = handles.size() == urls.size() ? 1 : 0;
+		while (running) {
+			if (curl_multi_perform(multi.get(), &running) != CURLM_OK)
+				break;
+			if (running && curl_multi_wait(multi.get(), nullptr, 0, 1000, nullptr) != CURLM_OK)
+				break;
+		}
+
+		std::map<CURL*, CURLcode> results;
+		int left = 0;
+		while (CURLMsg* message = curl_multi_info_read(multi.get(), &left)) {
+			if (message->msg == CURLMSG_DONE)
+				results[message->easy_handle] = message->data.result;
+		}
+		for (const auto& handle : handles)
+			curl_multi_remove_handle(multi.get(), handle.get());
+
+		std::vector<uint64_t> lengths;
+		for (const auto& handle : handles) {
+			const auto result = results.find(handle.get());
+			if (result == results.end() || result->second != CURLE_OK)
+				break;
+
+			// TODO: use return codes
+			double size = 0;
+			curl_easy_getinfo(handle.get(), CURLINFO_CONTENT_LENGTH_DOWNLOAD, &size);
+			lengths.push_back((uint64_t)size);
+		}
+		if (lengths.size() != urls.size())
+			throw 1; // TODO: replace with some sensible exception
+
+		return lengths;
+	}
+
+	// seconds from the milliseconds libdash parsed the manifest times into, negative stays unknown
+	double DashSeconds(int64_t milliseconds) {
+		return milliseconds < 0 ? -1 : milliseconds / 1000.0;
+	}
+
+	// seconds, negative if the mpd doesn't tell
+	double GetDashPeriodDuration(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period) {
+		assert(mpd && period);
+		if (period->GetDurationInMs() >= 0)
+			return DashSeconds(period->GetDurationInMs());
+
+		const double start = period->GetStart().empty() ? 0 : DashSeconds(period->GetStartInMs());
+		if (start < 0)
+			return -1;
+
+		// the next period starts where this one ends
+		const auto& periods = mpd->GetPeriods();
+		const auto it = std::find(periods.begin(), periods.end(), period);
+		if (it != periods.end() && it + 1 != periods.end() && (*(it + 1))->GetStartInMs() >= 0)
+			return DashSeconds((*(it + 1))->GetStartInMs()) - start;
+
+		if (mpd->GetMediaPresentationDurationInMs() >= 0)
+			return DashSeconds(mpd->GetMediaPresentationDurationInMs()) - start;
+
+		return -1;
+	}
+
+	// part of a period segments are taken from, in seconds since its start
+	struct DashWindow {
+		double from;
+		double to; // negative if unknown
+		bool bLive; // nothing past the end is available yet
+	};
+
+	DashWindow GetDashStaticWindow(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period) {
+		const DashWindow window = { 0, GetDashPeriodDuration(mpd, period), false };
+		return window;
+	}
+
+	// what a dynamic presentation offers right now, joining starts a bit behind the live edge
+	DashWindow GetDashLiveWindow(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period, bool bJoin) {
+		static const double DefaultDelay = 10; // seconds
+
+		const double availabilityStart = DashSeconds(mpd->GetAvailabilityStarttimeInMs());
+		if (availabilityStart < 0)
+			throw 1; // TODO: replace with some sensible exception
+
+		// TODO: honor UTCTiming when the clocks disagree
+		const double periodStart = period->GetStart().empty() ? 0 : DashSeconds(period->GetStartInMs());
+		DashWindow window = { 0, (double)time(nullptr) - availabilityStart - std::max(periodStart, 0.0), true };
+
+		const double periodDuration = DashSeconds(period->GetDurationInMs());
+		if (periodDuration >= 0)
+			window.to = std::min(window.to, periodDuration);
+		if (window.to < 0)
+			window.to = 0;
+
+		if (bJoin) {
+			double delay = DashSeconds(mpd->GetSuggestedPresentationDelayInMs());
+			if (delay < 0)
+				delay = DashSeconds(mpd->GetMinBufferTimeInMs());
+			if (delay <= 0)
+				delay = DefaultDelay;
+			window.from = window.to - delay;
+		} else {
+			const double depth = DashSeconds(mpd->GetTimeShiftBufferDepthInMs());
+			window.from = depth < 0 ? 0 : window.to - depth;
+		}
+		window.from = std::max(window.from, 0.0);
+
+		return window;
+	}
+
+	// base urls in effect below the given level, libdash resolves each against the ones before it
+	std::vector<dash::mpd::IBaseUrl*> GetDashBaseUrls(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet, const dash::mpd::IRepresentation* representation)
+	{
+		assert(mpd && period && adaptationSet);
+		std::vector<dash::mpd::IBaseUrl*> baseUrls(1, mpd->GetMPDPathBaseUrl());
+
+		auto add = [&](const std::vector<dash::mpd::IBaseUrl*>& urls) {
+			// TODO: support alternative base urls
+			if (!urls.empty())
+				baseUrls.push_back(urls.front());
+		};
+		add(mpd->GetBaseUrls());
+		add(period->GetBaseURLs());
+		add(adaptationSet->GetBaseURLs());
+		if (representation)
+			add(representation->GetBaseURLs());
+
+		return baseUrls;
+	}
+
+	QuviSegment ToQuviSegment(dash::mpd::ISegment* raw) {
+		std::unique_ptr<dash::mpd::ISegment> segment(raw);
+		if (!segment)
+			throw 1; // TODO: replace with some sensible exception
+
+		// the segment setters hide the chunk getters
+		dash::network::IChunk& chunk = *segment;
+		if (chunk.AbsoluteURI().empty())
+			throw 1; // TODO: replace with some sensible exception
+
+		QuviSegment result;
+		result.url = chunk.AbsoluteURI();
+		if (chunk.HasByteRange()) {
+			result.ranged = true;
+			result.first = chunk.StartByte();
+			result.last = chunk.EndByte();
+		}
+		return result;
+	}
+
+	// init segment followed by every media segment inside the window
+	QuviSegmentedRepresentation GetDashTemplateRepresentation(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet, const dash::mpd::IRepresentation* representation, const DashWindow& window)
+	{
+		const dash::mpd::ISegmentTemplate* segmentTemplate = representation->GetSegmentTemplate();
+		if (!segmentTemplate)
+			segmentTemplate = adaptationSet->GetSegmentTemplate();
+		if (!segmentTemplate)
+			segmentTemplate = period->GetSegmentTemplate();
+		assert(segmentTemplate);
+
+		const auto baseUrls = GetDashBaseUrls(mpd, period, adaptationSet, representation);
+		const std::string& id = representation->GetId();
+		const uint32_t bandwidth = representation->GetBandwidth();
+
+		QuviSegmentedRepresentation result;
+		result.bandwidth = bandwidth;
+		auto& segments = result.segments;
+
+		if (!segmentTemplate->Getinitialization().empty()) {
+			segments.push_back(ToQuviSegment(segmentTemplate->ToInitializationSegment(baseUrls, id, bandwidth)));
+			result.bInitialization = true;
+		} else if (const auto initialization = segmentTemplate->GetInitialization()) {
+			segments.push_back(ToQuviSegment(initialization->ToSegment(baseUrls)));
+			result.bInitialization = true;
+		}
+
+		const std::string& media = segmentTemplate->Getmedia();
+		const bool bByTime = media.find("$Time") != std::string::npos;
+		const uint32_t timescale = segmentTemplate->GetTimescale() ? segmentTemplate->GetTimescale() : 1;
+		uint64_t number = segmentTemplate->GetStartNumber();
+
+		if (const auto segmentTimeline = segmentTemplate->GetSegmentTimeline()) {
+			// window in timeline units
+			const uint64_t offset = segmentTemplate->GetPresentationTimeOffset();
+			const uint64_t from = (uint64_t)(window.from * timescale) + offset;
+			const uint64_t to = window.to < 0 ? UINT64_MAX : (uint64_t)(window.to * timescale + 0.5) + offset;
+
+			// an open ended timeline needs the window to end somewhere
+			if (segmentTimeline->GetSegmentCount() == UINT64_MAX && to == UINT64_MAX)
+				throw 1; // TODO: replace with some sensible exception
+
+			// the index jumps straight to the first segment of the window instead of walking the timeline
+			uint64_t index = 0, time = 0, duration = 0;
+			if (segmentTimeline->FindSegmentByTime(from, index, time, duration)) {
+				for (; segmentTimeline->FindSegmentByIndex(index, time, duration); index++) {
+					if (window.bLive ? time + duration > to : time >= to)
+						break;
+					segments.push_back(ToQuviSegment(bByTime ?
+						segmentTemplate->GetMediaSegmentFromTime(baseUrls, id, bandwidth, time) :
+						segmentTemplate->GetMediaSegmentFromNumber(baseUrls, id, bandwidth, number + index)));
+				}
+			}
+		} else {
+			const uint64_t duration = segmentTemplate->GetDuration();
+			if (!duration || window.to < 0)
+				throw 1; // TODO: replace with some sensible exception
+			const uint64_t first = (uint64_t)(window.from * timescale) / duration;
+			const uint64_t units = (uint64_t)(window.to * timescale + 0.5);
+			// the last segment of a finished period may be shorter, a live one isn't there until it's complete
+			const uint64_t end = window.bLive ? units / duration : (units + duration - 1) / duration;
+			for (uint64_t j = first; j < end; j++) {
+				segments.push_back(ToQuviSegment(
+					segmentTemplate->GetMediaSegmentFromNumber(baseUrls, id, bandwidth, number + j)));
+			}
+		}
+
+		return result;
+	}
+
+	// init segment followed by every listed media segment inside the window, as far as the list tells durations
+	QuviSegmentedRepresentation GetDashListRepresentation(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet, const dash::mpd::IRepresentation* representation, const DashWindow& window)
+	{
+		const dash::mpd::ISegmentList* segmentList = representation->GetSegmentList();
+		if (!segmentList)
+			segmentList = adaptationSet->GetSegmentList();
+		if (!segmentList)
+			segmentList = period->GetSegmentList();
+		assert(segmentList);
+
+		const auto baseUrls = GetDashBaseUrls(mpd, period, adaptationSet, representation);
+
+		// segments without their own url are ranges of the base url
+		auto toSegment = [&](const std::string& url, const std::string& range, std::function<dash::mpd::ISegment*(const std::vector<dash::mpd::IBaseUrl*>&)> create) {
+			if (!url.empty())
+				return ToQuviSegment(create(baseUrls));
+
+			std::vector<dash::mpd::IBaseUrl*> parentUrls(baseUrls.begin(), baseUrls.end() - 1);
+			QuviSegment segment = ToQuviSegment(baseUrls.back()->ToMediaSegment(parentUrls));
+			if (!range.empty()) {
+				unsigned long long first = 0, last = 0;
+				if (sscanf(range.c_str(), "%llu-%llu", &first, &last) != 2 || first > last)
+					throw 1; // TODO: replace with some sensible exception
+				segment.ranged = true;
+				segment.first = first;
+				segment.last = last;
+			}
+			return segment;
+		};
+
+		QuviSegmentedRepresentation result;
+		result.bandwidth = representation->GetBandwidth();
+
+		if (const auto initialization = segmentList->GetInitialization()) {
+			result.segments.push_back(toSegment(initialization->GetSourceURL(), initialization->GetRange(),
+				[&](const std::vector<dash::mpd::IBaseUrl*>& urls) { return initialization->ToSegment(urls); }));
+			result.bInitialization = true;
+		}
+
+		const uint32_t timescale = segmentList->GetTimescale() ? segmentList->GetTimescale() : 1;
+		const double duration = (double)segmentList->GetDuration() / timescale;
+		const auto& segmentUrls = segmentList->GetSegmentURLs();
+		for (size_t i = 0; i < segmentUrls.size(); i++) {
+			if (duration > 0 && (i + 1) * duration <= window.from)
+				continue;
+			const auto& segmentUrl = segmentUrls[i];
+			result.segments.push_back(toSegment(segmentUrl->GetMediaURI(), segmentUrl->GetMediaRange(),
+				[&](const std::vector<dash::mpd::IBaseUrl*>& urls) { return segmentUrl->ToMediaSegment(urls); }));
+		}
+
+		return result;
+	}
+
+	size_t CurlAppendCallback(char* ptr, size_t size, size_t nmemb, void* userdata) {
+		auto& buffer = *static_cast<std::vector<char>*>(userdata);
+		buffer.insert(buffer.end(), ptr, ptr + size * nmemb);
+		return size * nmemb;
+	}
+
+	// inclusive byte range of the url, empty on failure
+	std::vector<char> FetchRange(CURL* curl, const std::string& url, uint64_t first, uint64_t last) {
+		std::vector<char> buffer;
+
+		CURL* fetch = curl_easy_duphandle(curl);
+		if (!fetch)
+			return buffer;
+
+		const std::string range = std::to_string(first) + "-" + std::to_string(last);
+		curl_easy_setopt(fetch, CURLOPT_URL, url.c_str());
+		curl_easy_setopt(fetch, CURLOPT_HTTPGET, 1L);
+		curl_easy_setopt(fetch, CURLOPT_RANGE, range.c_str());
+		curl_easy_setopt(fetch, CURLOPT_WRITEFUNCTION, CurlAppendCallback);
+		curl_easy_setopt(fetch, CURLOPT_WRITEDATA, &buffer);
+
+		const CURLcode cc = curl_easy_perform(fetch);
+		long code = 0;
+		curl_easy_getinfo(fetch, CURLINFO_RESPONSE_CODE, &code);
+		curl_easy_cleanup(fetch);
+
+		// a whole resource instead of the range is no good either
+		if (cc != CURLE_OK || code != 206 || buffer.size() != last - first + 1)
+			buffer.clear();
+
+		return buffer;
+	}
+
+	// whole manifest through our curl stack rather than libxml's own client, so it gets shared connections and https,
+	// empty on failure; relative urls inside refer to where the redirects ended up
+	std::vector<char> FetchManifest(CURL* curl, const std::string& url, std::string& effectiveUrl) {
+		std::vector<char> buffer;
+		effectiveUrl = url;
+
+		CURL* fetch = curl_easy_duphandle(curl);
+		if (!fetch)
+			return buffer;
+
+		curl_easy_setopt(fetch, CURLOPT_URL, url.c_str());
+		curl_easy_setopt(fetch, CURLOPT_HTTPGET, 1L);
+		curl_easy_setopt(fetch, CURLOPT_FOLLOWLOCATION, 1L);
+		curl_easy_setopt(fetch, CURLOPT_WRITEFUNCTION, CurlAppendCallback);
+		curl_easy_setopt(fetch, CURLOPT_WRITEDATA, &buffer);
+
+		const CURLcode cc = curl_easy_perform(fetch);
+		long code = 0;
+		curl_easy_getinfo(fetch, CURLINFO_RESPONSE_CODE, &code);
+		char* effective = nullptr;
+		if (curl_easy_getinfo(fetch, CURLINFO_EFFECTIVE_URL, &effective) == CURLE_OK && effective)
+			effectiveUrl = effective;
+		curl_easy_cleanup(fetch);
+
+		if (cc != CURLE_OK || code >= 300)
+			buffer.clear();
+
+		return buffer;
+	}
+
+	// null on failure
+	dash::mpd::IMPD* OpenDashManifest(dash::IDASHManager* manager, CURL* curl, const std::string& url) {
+		std::string effectiveUrl;
+		const std::vector<char> data = FetchManifest(curl, url, effectiveUrl);
+		if (data.empty())
+			return nullptr;
+		return manager->Open(data.data(), data.size(), effectiveUrl.c_str());
+	}
+
+	// remote elements of the manifest come through our curl stack too, libdash reads each on a thread of its own
+	class DashXLinkConnection final : public dash::network::IConnection {
+		static const long FetchTimeout = 10000; // ms, a stalled server mustn't hold up opening or refreshing
+
+		std::shared_ptr<CURL> m_curl;
+		std::mutex m_mutex;
+		struct Document {
+			std::vector<char> data;
+			size_t read; // bytes
+		};
+		std::map<dash::network::IChunk*, Document> m_documents;
+		std::vector<dash::metrics::ITCPConnection*> m_tcpConnections;
+		std::vector<dash::metrics::IHTTPTransaction*> m_httpTransactions;
+
+	public:
+		// duplicates the handle, so it has to be called on the thread owning it
+		explicit DashXLinkConnection(CURL* curl)
+			: m_curl(DuplicateCurl(curl))
+		{
+			if (!m_curl)
+				throw 1; // TODO: replace with some sensible exception
+			curl_easy_setopt(m_curl.get(), CURLOPT_TIMEOUT_MS, FetchTimeout);
+		}
+
+		virtual int Read(uint8_t* data, size_t len, dash::network::IChunk* chunk) override {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto it = m_documents.find(chunk);
+			if (it == m_documents.end()) {
+				// the whole element is fetched on the first read, outside the lock so the others go on meanwhile
+				CURL* fetch = curl_easy_duphandle(m_curl.get());
+				lock.unlock();
+				Document document = {};
+				if (fetch) {
+					std::string effectiveUrl;
+					document.data = FetchManifest(fetch, chunk->AbsoluteURI(), effectiveUrl);
+					curl_easy_cleanup(fetch);
+				}
+				lock.lock();
+				it = m_documents.emplace(chunk, std::move(document)).first;
+			}
+
+			auto& document = it->second;
+			const size_t count = std::min(len, document.data.size() - document.read);
+			if (count)
+				memcpy(data, document.data.data() + document.read, count);
+			document.read += count;
+
+			// libdash stops reading the chunk at the end
+			if (!count)
+				m_documents.erase(it);
+			return (int)count;
+		}
+
+		virtual int Peek(uint8_t* data, size_t len, dash::network::IChunk* chunk) override {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_documents.find(chunk);
+			if (it == m_documents.end())
+				return 0;
+			const auto& document = it->second;
+			const size_t count = std::min(len, document.data.size() - document.read);
+			if (count)
+				memcpy(data, document.data.data() + document.read, count);
+			return (int)count;
+		}
+
+		virtual const std::vector<dash::metrics::ITCPConnection*>& GetTCPConnectionList() const override { return m_tcpConnections; }
+		virtual const std::vector<dash::metrics::IHTTPTransaction*>& GetHTTPTransactionList() const override { return m_httpTransactions; }
+	};
+
+	// splits the file into the header and the subsegments listed by its sidx box,
+	// which starts at the given offset of the file, empty if the index isn't usable
+	std::vector<QuviSegment> ParseSidx(const std::vector<char>& data, const std::string& url, uint64_t offset) {
+		auto be = [&](size_t pos, size_t bytes) {
+			uint64_t value = 0;
+			for (size_t i = 0; i < bytes; i++)
+				value = (value << 8) | (uint8_t)data[pos + i];
+			return value;
+		};
+
+		std::vector<QuviSegment> segments;
+
+		if (data.size() < 8 || memcmp(&data[4], "sidx", 4))
+			return segments;
+
+		uint64_t size = be(0, 4);
+		size_t pos = 8;
+		if (size == 1) {
+			if (data.size() < 16)
+				return segments;
+			size = be(8, 8);
+			pos = 16;
+		}
+		if (size > data.size() || size < pos + 24)
+			return segments;
+
+		const uint8_t version = (uint8_t)data[pos];
+		pos += 4 + 4 + 4; // version and flags, reference id, timescale
+
+		uint64_t firstOffset;
+		if (version == 0) {
+			firstOffset = be(pos + 4, 4);
+			pos += 8;
+		} else {
+			if (size < pos + 20)
+				return segments;
+			firstOffset = be(pos + 8, 8);
+			pos += 16;
+		}
+
+		pos += 2; // reserved
+		const size_t count = (size_t)be(pos, 2);
+		pos += 2;
+		if (!count || size < pos + count * 12)
+			return segments;
+
+		// first subsegment follows the box
+		uint64_t start = offset + size + firstOffset;
+
+		QuviSegment header;
+		header.url = url;
+		header.ranged = true;
+		header.first = 0;
+		header.last = start - 1;
+		segments.push_back(header);
+
+		for (size_t i = 0; i < count; i++, pos += 12) {
+			const uint32_t reference = (uint32_t)be(pos, 4);
+			const uint32_t length = reference & 0x7fffffff;
+			// TODO: support hierarchical indexes
+			if ((reference & 0x80000000) || !length) {
+				segments.clear();
+				break;
+			}
+
+			QuviSegment subsegment;
+			subsegment.url = url;
+			subsegment.ranged = true;
+			subsegment.first = start;
+			subsegment.last = start + length - 1;
+			segments.push_back(subsegment);
+			start += length;
+		}
+
+		return segments;
+	}
+
+	// header and subsegments of a single file representation, empty if it has no usable index
+	std::vector<QuviSegment> GetDashIndexedSegments(CURL* curl, const std::string& url, const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet, const dash::mpd::IRepresentation* representation)
+	{
+		const dash::mpd::ISegmentBase* segmentBase = representation->GetSegmentBase();
+		if (!segmentBase)
+			segmentBase = adaptationSet->GetSegmentBase();
+		if (!segmentBase)
+			segmentBase = period->GetSegmentBase();
+
+		unsigned long long first = 0, last = 0;
+		if (!segmentBase || sscanf(segmentBase->GetIndexRange().c_str(), "%llu-%llu", &first, &last) != 2 || first > last)
+			return std::vector<QuviSegment>();
+
+		const std::vector<char> index = FetchRange(curl, url, first, last);
+		if (index.empty())
+			return std::vector<QuviSegment>();
+
+		return ParseSidx(index, url, first);
+	}
+
+	QuviSegmentedRepresentation GetDashSegmentedRepresentation(const dash::mpd::IMPD* mpd, const dash::mpd::IPeriod* period,
+		const dash::mpd::IAdaptationSet* adaptationSet, const dash::mpd::IRepresentation* representation, const DashWindow& window)
+	{
+		switch (DetermineDashType(period, adaptationSet, representation)) {
+			case DashRepresentationType::Template:
+				return GetDashTemplateRepresentation(mpd, period, adaptationSet, representation, window);
+			case DashRepresentationType::List:
+				return GetDashListRepresentation(mpd, period, adaptationSet, representation, window);
+			default:
+				throw 1; // TODO: replace with some sensible exception
+		}
+	}
+
+	// tells segments apart across revisions of a manifest
+	std::string GetDashSegmentKey(const QuviSegment& segment) {
+		return segment.ranged ? segment.url + "#" + std::to_string(segment.first) + "-" + std::to_string(segment.last) : segment.url;
+	}
+
+	// whether encodings of the adaptation set can be switched between at segment boundaries
+	bool IsDashSwitchable(const dash::mpd::IAdaptationSet* adaptationSet) {
+		if (adaptationSet->GetBitstreamSwitching())
+			return true;
+		if (adaptationSet->SegmentAlignmentIsBoolValue() ? adaptationSet->HasSegmentAlignment() : adaptationSet->GetSegmentAligment() != 0)
+			return true;
+		return adaptationSet->SubsegmentAlignmentIsBoolValue() ? adaptationSet->HasSubsegmentAlignment() : adaptationSet->GetSubsegmentAlignment() != 0;
+	}
+
+	std::unique_ptr<QuviAdaptationPolicy> CreateAdaptationPolicy(QuviAdaptation adaptation) {
+		switch (adaptation) {
+			case QuviAdaptation::Buffer:
+				return std::make_unique<QuviBufferPolicy>();
+			default:
+				return std::make_unique<QuviThroughputPolicy>();
+		}
+	}
+}
+
+void QuviMedia::CurlShare::CurlShareLockFunction(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr) {
 	UNREFERENCED_PARAMETER(handle);
 	assert(access != CURL_LOCK_ACCESS_NONE);
-	if (access == CURL_LOCK_ACCESS_SHARED || access == CURL_LOCK_ACCESS_SINGLE) {
-		auto& locks = *static_cast<CurlSharedLock*>(userptr);
-		locks[data].lock();
+	auto& entry = (*static_cast<CurlSharedLock*>(userptr))[data];
+	if (access == CURL_LOCK_ACCESS_SHARED) {
+		AcquireSRWLockShared(&entry.lock);
+	} else if (access == CURL_LOCK_ACCESS_SINGLE) {
+		AcquireSRWLockExclusive(&entry.lock);
+		entry.writer = GetCurrentThreadId();
 	}
 }
 
-void QuviMedia::CurlShareUnlockFunction(CURL* handle, curl_lock_data data, void* userptr) {
+void QuviMedia::CurlShare::CurlShareUnlockFunction(CURL* handle, curl_lock_data data, void* userptr) {
 	UNREFERENCED_PARAMETER(handle);
-	auto& locks = *static_cast<CurlSharedLock*>(userptr);
-	locks[data].unlock();
+	auto& entry = (*static_cast<CurlSharedLock*>(userptr))[data];
+	// curl doesn't tell how the lock was taken, but only the exclusive owner can find itself recorded
+	if (entry.writer == GetCurrentThreadId()) {
+		entry.writer = 0;
+		ReleaseSRWLockExclusive(&entry.lock);
+	} else {
+		ReleaseSRWLockShared(&entry.lock);
+	}
 }
 
-QuviMedia::QuviMedia(std::wstring&& url)
-	: QuviMediaInfo(std::move(url))
-	, m_curlsh(curl_share_init())
+QuviMedia::CurlShare::CurlShare()
+	: m_curlsh(curl_share_init())
 {
-	assert(m_curlsh); // TODO: throw exception
+	if (!m_curlsh)
+		throw 1; // TODO: replace with some sensible exception
 	curl_share_setopt(m_curlsh, CURLSHOPT_LOCKFUNC, CurlShareLockFunction);
 	curl_share_setopt(m_curlsh, CURLSHOPT_UNLOCKFUNC, CurlShareUnlockFunction);
 	curl_share_setopt(m_curlsh, CURLSHOPT_SHARE, CURL_LOCK_DATA_COOKIE);
 	curl_share_setopt(m_curlsh, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
 	curl_share_setopt(m_curlsh, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	// only honored by libcurl 7.57 and newer, older ones keep connections per handle
+	curl_share_setopt(m_curlsh, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
 	curl_share_setopt(m_curlsh, CURLSHOPT_USERDATA, &m_curlshLock);
+}
 
+QuviMedia::CurlShare& QuviMedia::GetCurlShare() {
+	// no thread-safe function statics in our compiler
+	static std::once_flag once;
+	static std::unique_ptr<CurlShare> share;
+	std::call_once(once, []() { share = std::make_unique<CurlShare>(); });
+	return *share;
+}
+
+QuviMedia::QuviMedia(std::wstring&& url, const std::wstring& format, size_t segmentsInFlight, QuviAdaptation adaptation)
+	: QuviMediaInfo(std::move(url), format)
+	, m_curlsh(GetCurlShare())
+{
 	curl_easy_setopt(m_curl, CURLOPT_SHARE, m_curlsh);
 	// TODO: ensure that cookies are properly inherited
 
 	if (GetContentType() == "video/vnd.mpeg.dash.mpd") {
-		std::string murl = GetMultibyteUrl();
+		const std::string murl = GetMultibyteUrl();
 		if (murl.empty())
 			throw 1; // TODO: replace with some sensible exception
+		// outlives the manager using it
+		const auto xlinkConnection = std::make_shared<DashXLinkConnection>(m_curl);
 		std::unique_ptr<dash::IDASHManager> manager(CreateDashManager());
 		if (!manager)
 			throw 1; // TODO: replace with some sensible exception
-		std::unique_ptr<dash::mpd::IMPD> mpd(manager->Open(&murl[0]));
+		// manifests of big live events carry hundreds of adaptation sets, converting them scales with the cores
+		manager->SetConversionThreads(std::thread::hardware_concurrency());
+		manager->SetXLinkConnection(xlinkConnection.get());
+		std::unique_ptr<dash::mpd::IMPD> mpd(OpenDashManifest(manager.get(), m_curl, murl));
 		if (!mpd)
 			throw 1; // TODO: replace with some sensible exception
 
-		const auto& period = mpd->GetPeriods().front();
+		const bool bLive = mpd->GetType() == "dynamic";
 
-		for (const auto& adaptationSet : period->GetAdaptationSets()) {
-			const auto& representation = adaptationSet->GetRepresentation().back();
-
-			enum class DashRepresentationType {
-				Base,
-				Template,
-				List,
-			};
-
-			auto determineType = [](const dash::mpd::IPeriod* period,
-				const dash::mpd::IAdaptationSet* adaptationSet,
-				const dash::mpd::IRepresentation* representation) -> DashRepresentationType {
-				assert(representation && adaptationSet && period);
-				if (representation->GetSegmentList())
-					return DashRepresentationType::List;
-				if (representation->GetSegmentTemplate())
-					return DashRepresentationType::Template;
-				if (representation->GetSegmentBase() || !representation->GetBaseURLs().empty())
-					return DashRepresentationType::Base;
-
-				if (adaptationSet->GetSegmentList())
-					return DashRepresentationType::List;
-				if (adaptationSet->GetSegmentTemplate())
-					return DashRepresentationType::Template;
-				if (adaptationSet->GetSegmentBase())
-					return DashRepresentationType::Base;
-
-				if (period->GetSegmentList())
-					return DashRepresentationType::List;
-				if (period->GetSegmentTemplate())
-					return DashRepresentationType::Template;
-				if (period->GetSegmentBase())
-					return DashRepresentationType::Base;
+		// a live presentation is joined in its latest period
+		std::vector<dash::mpd::IPeriod*> periods = mpd->GetPeriods();
+		if (periods.empty())
+			throw 1; // TODO: replace with some sensible exception
+		if (bLive)
+			periods.erase(periods.begin(), periods.end() - 1);
 
-				throw 1; // TODO: replace with some sensible exception
-			};
+		auto getWindow = [&](const dash::mpd::IPeriod* period) {
+			return bLive ? GetDashLiveWindow(mpd.get(), period, true) : GetDashStaticWindow(mpd.get(), period);
+		};
 
-			const DashRepresentationType type = determineType(period, adaptationSet, representation);
+		// a whole resource per period is streamed as is, anything else goes through segments
+		struct PeriodStream {
+			bool bSingle;
+			QuviSegmentedRepresentation representation;
+		};
+		auto openPeriod = [&](const dash::mpd::IPeriod* period, const dash::mpd::IAdaptationSet* adaptationSet,
+			const dash::mpd::IRepresentation* representation, const DashWindow& window)
+		{
+			PeriodStream stream = {};
+			if (DetermineDashType(period, adaptationSet, representation) != DashRepresentationType::Base) {
+				stream.representation = GetDashSegmentedRepresentation(mpd.get(), period, adaptationSet, representation, window);
+				return stream;
+			}
 
-			if (type != DashRepresentationType::Base) // TODO: support other stream types
+			// TODO: support live single file representations
+			if (bLive)
 				throw 1; // TODO: replace with some sensible exception
 
 			// TODO: support compound urls
-			std::unique_ptr<dash::network::IChunk> chunk(representation->GetBaseURLs()[0]->ToMediaSegment({}));
-			if (!chunk)
+			if (representation->GetBaseURLs().empty())
 				throw 1; // TODO: replace with some sensible exception
+			const auto baseUrl = representation->GetBaseURLs()[0];
+			const auto baseUrls = GetDashBaseUrls(mpd.get(), period, adaptationSet, nullptr);
+			const QuviSegment whole = ToQuviSegment(baseUrl->ToMediaSegment(baseUrls));
+
+			// with an index the file is fetched subsegment by subsegment and seeks land exactly
+			auto& segments = stream.representation.segments;
+			stream.representation.bandwidth = representation->GetBandwidth();
+			segments = GetDashIndexedSegments(m_curl, whole.url, period, adaptationSet, representation);
+			stream.bSingle = segments.empty();
+			stream.representation.bInitialization = !stream.bSingle;
+			if (stream.bSingle)
+				segments.push_back(whole);
+			return stream;
+		};
+
+		// whole files are opened once their lengths are in, which are asked for all together
+		struct WholeStream {
+			size_t backend;
+			std::string url;
+		};
+		std::vector<WholeStream> wholeStreams;
+
+		// what a live stream needs to be continued on refresh
+		struct LiveStream {
+			QuviSegmentedBackend* backend;
+			// nothing of the model is held on to, a refresh frees whatever it replaced
+			DashAdaptationSetKey adaptationSet;
+			std::vector<std::string> representations; // ids, in the order given to the backend
+			std::vector<std::string> last; // segment handed over last, per representation
+			bool bEnded; // finished, nothing more gets appended
+		};
+		std::vector<LiveStream> liveStreams;
+		auto addLive = [&](size_t index, const dash::mpd::IAdaptationSet* adaptationSet,
+			const std::vector<const dash::mpd::IRepresentation*>& representations,
+			const std::vector<QuviSegmentedRepresentation>& segmented)
+		{
+			LiveStream stream = { static_cast<QuviSegmentedBackend*>(m_backends.back().get()), GetDashAdaptationSetKey(adaptationSet, index) };
+			for (size_t i = 0; i < representations.size(); i++) {
+				const auto& segments = segmented[i].segments;
+				const bool bMedia = segments.size() > (segmented[i].bInitialization ? 1u : 0u);
+				stream.representations.push_back(representations[i]->GetId());
+				stream.last.push_back(bMedia ? GetDashSegmentKey(segments.back()) : std::string());
+			}
+			liveStreams.emplace_back(std::move(stream));
+		};
+
+		// every adaptation set of the first period is a stream, later periods continue it
+		const auto& adaptationSets = periods.front()->GetAdaptationSets();
+		for (size_t i = 0; i < adaptationSets.size(); i++) {
+			// switch between encodings when they're split the same way
+			// TODO: adapt across periods
+			const auto& representations = adaptationSets[i]->GetRepresentation();
+			if (periods.size() == 1 && representations.size() > 1 && IsDashSwitchable(adaptationSets[i])) {
+				const DashWindow window = getWindow(periods.front());
+				std::vector<QuviSegmentedRepresentation> alternatives;
+				for (const auto& representation : representations) {
+					PeriodStream stream = openPeriod(periods.front(), adaptationSets[i], representation, window);
+					if (stream.bSingle || (!alternatives.empty() && (alternatives.front().segments.size() != stream.representation.segments.size() ||
+						alternatives.front().bInitialization != stream.representation.bInitialization)))
+					{
+						alternatives.clear();
+						break;
+					}
+					alternatives.emplace_back(std::move(stream.representation));
+				}
+
+				if (!alternatives.empty()) {
+					const std::vector<const dash::mpd::IRepresentation*> given(representations.begin(), representations.end());
+					const std::vector<QuviSegmentedRepresentation> handed = bLive ? alternatives : std::vector<QuviSegmentedRepresentation>();
+					m_backends.emplace_back(std::make_unique<QuviSegmentedBackend>(std::move(alternatives), CreateAdaptationPolicy(adaptation),
+						adaptationSets[i]->GetBitstreamSwitching(), bLive, segmentsInFlight, m_curl, m_curlsh));
+					if (bLive)
+						addLive(i, adaptationSets[i], given, handed);
+					continue;
+				}
+			}
+
+			std::vector<PeriodStream> streams;
+			const dash::mpd::IAdaptationSet* adaptationSet = nullptr;
+			const DashAdaptationSetKey key = GetDashAdaptationSetKey(adaptationSets[i], i);
+			for (const auto& period : periods) {
+				adaptationSet = MatchDashAdaptationSet(period, key);
+				if (!adaptationSet)
+					throw 1; // TODO: replace with some sensible exception
+				streams.emplace_back(openPeriod(period, adaptationSet, adaptationSet->GetRepresentation().back(), getWindow(period)));
+			}
+
+			const bool bSingle = std::any_of(streams.begin(), streams.end(), [](const PeriodStream& stream) {
+				return stream.bSingle;
+			});
 
-			auto& uri = chunk->AbsoluteURI();
-			if (uri.empty())
+			// whole files glued together don't make one, the splitter would only take in the header of the first
+			if (bSingle && streams.size() > 1)
 				throw 1; // TODO: replace with some sensible exception
 
-			curl_easy_setopt(m_curl, CURLOPT_URL, &uri[0]);
-			curl_easy_setopt(m_curl, CURLOPT_NOBODY, 1L);
+			if (bSingle) {
+				wholeStreams.push_back({ m_backends.size(), streams.front().representation.segments.front().url });
+				m_backends.emplace_back();
+			} else {
+				// periods follow one another, each led by its own initialization segment
+				std::vector<QuviSegmentedRepresentation> joined(1);
+				joined.front().bandwidth = streams.front().representation.bandwidth;
+				joined.front().bInitialization = streams.front().representation.bInitialization;
+				for (auto& stream : streams) {
+					auto& segments = stream.representation.segments;
+					std::move(segments.begin(), segments.end(), std::back_inserter(joined.front().segments));
+				}
+				const std::vector<QuviSegmentedRepresentation> handed = bLive ? joined : std::vector<QuviSegmentedRepresentation>();
+				m_backends.emplace_back(std::make_unique<QuviSegmentedBackend>(std::move(joined), nullptr,
+					false, bLive, segmentsInFlight, m_curl, m_curlsh));
+				if (bLive)
+					addLive(i, adaptationSet, std::vector<const dash::mpd::IRepresentation*>(1, adaptationSet->GetRepresentation().back()), handed);
+			}
+		}
+
+		if (!wholeStreams.empty()) {
+			std::vector<std::string> urls;
+			for (const auto& stream : wholeStreams)
+				urls.push_back(stream.url);
+			const std::vector<uint64_t> lengths = GetRemoteLengths(m_curl, urls);
+
+			// every stream downloads on a thread of its own, so each gets a handle of its own
+			for (size_t i = 0; i < wholeStreams.size(); i++) {
+				const std::shared_ptr<CURL> curl = DuplicateCurl(m_curl);
+				if (!curl)
+					throw 1; // TODO: replace with some sensible exception
+				m_curls.push_back(curl);
+				m_backends[wholeStreams[i].backend] = std::make_unique<QuviSimpleStreamBackend>(wholeStreams[i].url, lengths[i], curl.get(), m_curlsh);
+			}
+		}
 
-			CURLcode cc = curl_easy_perform(m_curl);
-			if (cc != CURLE_OK)
+		if (bLive && !liveStreams.empty()) {
+			// without a minimum update period the manifest stays the same, but the live edge still moves
+			static const double DefaultUpdatePeriod = 2; // seconds
+			const double minimumUpdatePeriod = DashSeconds(mpd->GetMinimumUpdatePeriodInMs());
+			const bool bRefetch = minimumUpdatePeriod >= 0;
+			const auto updatePeriod = std::chrono::milliseconds((long long)(std::max(bRefetch ? minimumUpdatePeriod : DefaultUpdatePeriod, 1.0) * 1000));
+
+			// owned by the refresher thread from here on
+			struct LiveState {
+				std::shared_ptr<DashXLinkConnection> xlinkConnection; // declared first, so it goes last
+				std::unique_ptr<dash::IDASHManager> manager;
+				std::unique_ptr<dash::mpd::IMPD> mpd;
+				std::unique_ptr<dash::mpd::IMPDUpdate> update; // of the last refresh, keeps what it removed alive until the next one
+				std::vector<LiveStream> streams;
+				// the period joined, by id, or by start if it has none
+				std::string periodId;
+				std::string periodStart;
+			};
+			auto live = std::make_shared<LiveState>();
+			live->xlinkConnection = xlinkConnection;
+			live->manager = std::move(manager);
+			live->mpd = std::move(mpd);
+			live->streams = std::move(liveStreams);
+			live->periodId = periods.front()->GetId();
+			live->periodStart = periods.front()->GetStart();
+
+			// the refresher fetches on a handle of its own, m_curl stays with this thread
+			const std::shared_ptr<CURL> curl = DuplicateCurl(m_curl);
+			if (!curl)
 				throw 1; // TODO: replace with some sensible exception
+			auto refresh = [live, murl, bRefetch, curl]() -> bool {
+				auto& manager = live->manager;
+				auto& mpd = live->mpd;
+				auto& streams = live->streams;
+
+				// merged into the model in place, so everything unchanged keeps its address and only the new segments cost anything
+				std::unique_ptr<dash::mpd::IMPDUpdate> update;
+				if (bRefetch) {
+					const std::string url = mpd->GetLocations().empty() ? murl : mpd->GetLocations().front();
+					std::string effectiveUrl;
+					const std::vector<char> data = FetchManifest(curl.get(), url, effectiveUrl);
+					if (!data.empty())
+						update.reset(manager->Update(mpd.get(), data.data(), data.size(), effectiveUrl.c_str()));
+					if (!update)
+						return true; // try again next time
+				}
+				const dash::mpd::IMPD* current = mpd.get();
+
+				// a stream that can't be continued ends with what it has, rather than waiting for segments that won't come
+				auto end = [](LiveStream& stream) {
+					stream.backend->Finish();
+					stream.bEnded = true;
+				};
+
+				// streams stay in the period they joined, a later one would need its own initialization and a period switch of the reader
+				const auto& periods = current->GetPeriods();
+				if (periods.empty())
+					return true; // a broken revision, the next one may be fine
+				const auto joined = std::find_if(periods.begin(), periods.end(), [&live](const dash::mpd::IPeriod* period) {
+					return live->periodId.empty() ? period->GetStart() == live->periodStart : period->GetId() == live->periodId;
+				});
+				if (joined == periods.end()) {
+					for (auto& stream : streams) {
+						if (!stream.bEnded)
+							end(stream);
+					}
+					return false;
+				}
+				const auto period = *joined;
+
+				// once another period follows or the presentation turns static, the joined one is complete
+				const bool bStillLive = current->GetType() == "dynamic";
+				const bool bPeriodOpen = bStillLive && joined + 1 == periods.end();
+				DashWindow window = bStillLive ? GetDashLiveWindow(current, period, false) : GetDashStaticWindow(current, period);
+				if (bStillLive && !bPeriodOpen) {
+					const double duration = GetDashPeriodDuration(current, period);
+					if (duration >= 0)
+						window.to = std::min(window.to, duration);
+				}
 
-			// TODO: use return codes
-			long code = 0, proxycode = 0;
-			curl_easy_getinfo(m_curl, CURLINFO_RESPONSE_CODE, &code);
-			curl_easy_getinfo(m_curl, CURLINFO_HTTP_CONNECTCODE, &proxycode);
+				// rebuilt by the period only when a refresh changed its adaptation sets
+				const auto index = period->GetIndex();
+
+				bool bAnyOpen = false;
+				for (auto& stream : streams) {
+					if (stream.bEnded)
+						continue;
+
+					const auto adaptationSet = MatchDashAdaptationSet(period, stream.adaptationSet);
+					if (!adaptationSet) {
+						end(stream);
+						continue;
+					}
+
+					std::vector<std::vector<QuviSegment>> appended;
+					for (const auto& id : stream.representations) {
+						const auto representation = index->GetRepresentation(id);
+						if (!representation || index->GetAdaptationSet(representation) != adaptationSet)
+							break;
+
+						auto segmented = GetDashSegmentedRepresentation(current, period, adaptationSet, representation, window);
+						auto& segments = segmented.segments;
+						const auto media = segments.begin() + (segmented.bInitialization ? 1 : 0);
+
+						// resume after the segment handed over last, from the start of the window if it's gone already
+						const std::string& last = stream.last[appended.size()];
+						auto resume = media;
+						for (auto it = segments.end(); it != media; --it) {
+							if (GetDashSegmentKey(*(it - 1)) == last) {
+								resume = it;
+								break;
+							}
+						}
+						appended.emplace_back(resume, segments.end());
+					}
+					if (appended.size() != stream.representations.size()) {
+						end(stream);
+						continue;
+					}
+
+					// representations can only go as far as all of them
+					size_t count = SIZE_MAX;
+					for (const auto& segments : appended)
+						count = std::min(count, segments.size());
+					if (count) {
+						for (size_t i = 0; i < appended.size(); i++) {
+							appended[i].resize(count);
+							stream.last[i] = GetDashSegmentKey(appended[i].back());
+						}
+						stream.backend->Append(std::move(appended));
+					}
+
+					// follow the adaptation set as this revision has it, copied so nothing points into the model
+					const auto& adaptationSets = period->GetAdaptationSets();
+					const size_t position = std::find(adaptationSets.begin(), adaptationSets.end(), adaptationSet) - adaptationSets.begin();
+					stream.adaptationSet = GetDashAdaptationSetKey(adaptationSet, position);
+					if (bPeriodOpen)
+						bAnyOpen = true;
+					else
+						end(stream);
+				}
 
-			double size = 0;
-			curl_easy_getinfo(m_curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &size);
+				if (update)
+					live->update = std::move(update);
+				return bAnyOpen;
+			};
 
-			curl_easy_setopt(m_curl, CURLOPT_HTTPGET, 1L);
-			m_backends.emplace_back(std::make_unique<QuviSimpleStreamBackend>((uint64_t)size, m_curl, m_curlsh));
+			m_refresher = std::thread([this, refresh, updatePeriod]() {
+				for (;;) {
+					{
+						std::unique_lock<std::mutex> lock(m_refresherMutex);
+						if (m_refresherCondition.wait_for(lock, updatePeriod, [this]() { return m_bRefresherStop; }))
+							return;
+					}
+					try {
+						if (!refresh())
+							return;
+					} catch (...) {
+						// a broken revision of the manifest shouldn't end the stream, the next one may be fine
+					}
+				}
+			});
 		}
 	} else {
 		assert(m_backends.empty());
-		m_backends.emplace_back(std::make_unique<QuviSimpleStreamBackend>(GetContentLength(), m_curl, m_curlsh));
+		m_backends.emplace_back(std::make_unique<QuviSimpleStreamBackend>(GetMultibyteUrl(), GetContentLength(), m_curl, m_curlsh));
 	}
 }
 
 QuviMedia::~QuviMedia() {
+	if (m_refresher.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_refresherMutex);
+			m_bRefresherStop = true;
+		}
+		m_refresherCondition.notify_all();
+		m_refresher.join();
+	}
 	curl_easy_setopt(m_curl, CURLOPT_SHARE, nullptr);
 	m_backends.clear();
-	curl_share_cleanup(m_curlsh);
 }
@@ -38,11 +38,14 @@ class QuviMediaInfo {
 	class QuviParse final {
 		quvi_media_t qm = {};
 	public:
-		QuviParse(Quvi& q, const std::wstring& url);
+		QuviParse(Quvi& q, const std::wstring& url, const std::string& format);
 		~QuviParse() { quvi_parse_close(&qm); }
 		operator quvi_media_t&() { return qm; }
 	};
 
+	// hands back the parse of the picked format when it had to make one, so it isn't parsed twice
+	static std::string SelectFormat(Quvi& q, const std::wstring& url, const std::wstring& format, std::unique_ptr<QuviParse>& parse);
+
 	std::wstring m_ourl;
 	std::wstring m_url;
 	std::string m_murl;
@@ -51,13 +54,15 @@ class QuviMediaInfo {
 	uint64_t m_contentLength = 0;
 
 	Quvi m_q;
-	QuviParse m_qp;
+	std::string m_format;
+	std::unique_ptr<QuviParse> m_qp;
 
 protected:
 	CURL* m_curl = nullptr;
 
 public:
-	QuviMediaInfo(std::wstring&& url);
+	// empty format means picking the best one the link can sustain
+	QuviMediaInfo(std::wstring&& url, const std::wstring& format);
 	virtual ~QuviMediaInfo() {}
 
 	const std::wstring& GetOriginalUrl() const { return m_ourl; }
@@ -66,6 +71,7 @@ public:
 	const std::wstring& GetTitle() const { return m_title; }
 	const std::string& GetContentType() const { return m_contentType; }
 	uint64_t GetContentLength() const { return m_contentLength; }
+	const std::string& GetFormat() const { return m_format; }
 };
 
 class QuviMediaBackend {
@@ -74,19 +80,52 @@ public:
 	virtual bool Get(uint64_t offset, size_t length, char* dest) = 0;
 	virtual uint64_t GetCurrentLength() = 0;
 	virtual uint64_t GetTotalLength() = 0;
+	// an estimated total length bounds nothing, Get() tells where the stream ends
+	virtual bool IsTotalLengthExact() { return true; }
+};
+
+// how the encoding of a dash stream is picked when there's a choice
+enum class QuviAdaptation {
+	Throughput, // highest bandwidth the link sustains
+	Buffer, // by how much is downloaded ahead, steadier on jittery links
 };
 
 class QuviMedia final : public QuviMediaInfo {
+	// handles of the backends that don't run on m_curl, declared first so they outlive them
+	std::vector<std::shared_ptr<CURL>> m_curls;
 	std::vector<std::unique_ptr<QuviMediaBackend>> m_backends;
 
+	// lives for the whole process, so consecutive opens skip dns lookups and full tls handshakes
+	class CurlShare final {
+		CURLSH* m_curlsh;
+		static void CurlShareLockFunction(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+		static void CurlShareUnlockFunction(CURL* handle, curl_lock_data data, void* userptr);
+		// slim reader/writer lock per curl data kind, so concurrent dns and tls session lookups don't serialize
+		struct CurlSharedLockEntry {
+			SRWLOCK lock;
+			std::atomic<DWORD> writer; // exclusive owner thread id, zero when held shared or not at all
+			CurlSharedLockEntry() : writer(0) { InitializeSRWLock(&lock); }
+		};
+		typedef std::array<CurlSharedLockEntry, CURL_LOCK_DATA_LAST> CurlSharedLock;
+		CurlSharedLock m_curlshLock;
+	public:
+		CurlShare();
+		~CurlShare() { curl_share_cleanup(m_curlsh); }
+		operator CURLSH*() { return m_curlsh; }
+	};
+	static CurlShare& GetCurlShare();
+
 	CURLSH* m_curlsh;
-	static void CurlShareLockFunction(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
-	static void CurlShareUnlockFunction(CURL* handle, curl_lock_data data, void* userptr);
-	typedef std::array<std::mutex, CURL_LOCK_DATA_LAST> CurlSharedLock;
-	CurlSharedLock m_curlshLock;
+
+	// keeps a live presentation going by refreshing its manifest
+	std::thread m_refresher;
+	std::mutex m_refresherMutex;
+	std::condition_variable m_refresherCondition;
+	bool m_bRefresherStop = false;
 
 public:
-	QuviMedia(std::wstring&& url);
+	// zero segments in flight leaves the choice to the segmented backend
+	QuviMedia(std::wstring&& url, const std::wstring& format, size_t segmentsInFlight, QuviAdaptation adaptation);
 	~QuviMedia();
 
 	const std::vector<std::unique_ptr<QuviMediaBackend>>& GetBackends() { return m_backends; }
@@ -24,13 +24,19 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <codecvt>
+#include <condition_variable>
+#include <functional>
 #include <future>
 #include <list>
 #include <locale>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include <cassert>
+#include <cfloat>
+#include <cmath>